@@ -8,6 +8,7 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "1_Radio.h"
+#include "2_Capture.h"
 #include "4_Display.h"
 #ifdef AUTOCONNECT_ENABLED
 #include "9_AutoConnect.h"
@@ -43,6 +44,9 @@ void set_Radio_mode(Radio_State new_State)
     switch (new_State)
     {
     case Radio_OFF:
+#if (defined(ESP32) || defined(ESP8266))
+      Capture_Stop();
+#endif
       PIN_RF_RX_DATA = NOT_A_PIN;
       PIN_RF_TX_DATA = NOT_A_PIN;
       radio.initialize();
@@ -58,9 +62,15 @@ void set_Radio_mode(Radio_State new_State)
       radio.attachUserInterrupt(NULL);
       detachInterrupt(0);
       detachInterrupt(1);
+#if (defined(ESP32) || defined(ESP8266))
+      Capture_Start();
+#endif
       break;
 
     case Radio_TX:
+#if (defined(ESP32) || defined(ESP8266))
+      Capture_Stop();
+#endif
       radio.receiveEnd();
       PIN_RF_RX_DATA = NOT_A_PIN;
       radio.transmitBegin();
@@ -197,10 +207,16 @@ void enableRX()
   if (PULLUP_RF_RX_DATA)
     pinMode(PIN_RF_RX_DATA, INPUT_PULLUP); // Initialise in/output ports
   delayMicroseconds(TRANSMITTER_STABLE_DELAY_US);
+#if (defined(ESP32) || defined(ESP8266))
+  Capture_Start(); // RF data pin edges are now timestamped under interrupt
+#endif
 }
 
 void disableRX()
 {
+#if (defined(ESP32) || defined(ESP8266))
+  Capture_Stop();
+#endif
   // RX pins
   pinMode(PIN_RF_RX_DATA, INPUT);
   pinMode(PIN_RF_RX_NA, INPUT);
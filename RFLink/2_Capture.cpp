@@ -0,0 +1,479 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// No Arduino dependency outside of the ESP interrupt part below,
+// so that the assembler can be built and fed with synthetic edges on a host.
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include "2_Signal.h"
+#include "2_Capture.h"
+#include "2_Stats.h"
+
+// AVR keeps its polling FetchSignal(), these buffers would not fit in its RAM anyway.
+#ifndef __AVR__
+
+#if (defined(ESP32) || defined(ESP8266))
+#include "1_Radio.h"
+#ifndef IRAM_ATTR
+#define IRAM_ATTR ICACHE_RAM_ATTR
+#endif
+#else
+#define IRAM_ATTR
+#endif
+
+#if (EDGE_BUFFER_SIZE & (EDGE_BUFFER_SIZE - 1))
+#error "EDGE_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if (RAW_SIGNAL_POOL < 2)
+#error "RAW_SIGNAL_POOL must be at least 2"
+#endif
+
+#define EDGE_MASK (EDGE_BUFFER_SIZE - 1)
+
+EdgeRingStruct EdgeRing;
+PackedSignalStruct PackedSignalPool[RAW_SIGNAL_POOL];
+unsigned long Capture_Dropped = 0;
+
+enum Pool_State
+{
+  Pool_Free,       // Available to the assembler
+  Pool_Assembling, // Being filled by the assembler
+  Pool_Ready,      // Complete, waiting in the ready queue
+  Pool_Decoding    // Handed over to the plugins
+};
+
+static struct
+{
+  byte State[RAW_SIGNAL_POOL];
+  byte Ready[RAW_SIGNAL_POOL]; // Queue of complete packets, oldest first
+  byte ReadyFirst;
+  byte ReadyCount;
+} Pool;
+
+enum Capture_State
+{
+  Capture_Seek,   // Waiting for a preamble
+  Capture_Message // Storing pulses
+};
+
+static struct
+{
+  Capture_State State;
+  PackedSignalStruct *Packet; // Buffer being filled, NULL when none was free (packet is only measured)
+  boolean Synced;             // At least one edge seen, LastEdge_us and Level are valid
+  uint8_t Level;              // Pin level since LastEdge_us
+  uint32_t LastEdge_us;       // Timestamp of the last transition
+  uint32_t PrevEdge_us;       // Timestamp of the transition before, start of the last stored pulse
+  byte Repairs;               // Spikes merged so far in this packet
+  unsigned int RawCodeLength; // Next pulse to store in Packet
+} Assembler;
+
+// ***********************************************************************************
+// Edge ring buffer
+// ***********************************************************************************
+void EdgeRing_Reset(EdgeRingStruct *ring)
+{
+  ring->Head = 0;
+  ring->Tail = 0;
+}
+
+boolean IRAM_ATTR EdgeRing_Push(EdgeRingStruct *ring, uint32_t time_us, uint8_t level)
+{
+  uint16_t head = ring->Head;
+  uint16_t next = (head + 1) & EDGE_MASK;
+
+  if (next == ring->Tail)
+  {
+    ring->Overruns++;
+    return false;
+  }
+  ring->Edges[head] = (time_us & ~1UL) | (level & 1);
+  ring->Head = next; // Publish only once the slot is written
+  return true;
+}
+
+boolean EdgeRing_Peek(EdgeRingStruct *ring, uint32_t &time_us, uint8_t &level)
+{
+  uint16_t tail = ring->Tail;
+
+  if (tail == ring->Head)
+    return false;
+  uint32_t edge = ring->Edges[tail];
+  time_us = edge & ~1UL;
+  level = edge & 1;
+  return true;
+}
+
+void EdgeRing_Pop(EdgeRingStruct *ring)
+{
+  ring->Tail = (ring->Tail + 1) & EDGE_MASK;
+}
+
+// ***********************************************************************************
+// Pulse sources
+// ***********************************************************************************
+SyntheticPulseSource::SyntheticPulseSource(uint32_t start_us, uint16_t jitter_us)
+{
+  EdgeRing_Reset(&Ring);
+  Ring.Overruns = 0;
+  Time_us = start_us;
+  Jitter_us = jitter_us;
+  Seed = 1;
+  Level = 0;
+}
+
+boolean SyntheticPulseSource::Hold(uint8_t level, uint32_t duration_us)
+{
+  if (level != Level)
+  {
+    if (!EdgeRing_Push(&Ring, Time_us, level))
+      return false;
+    Level = level;
+  }
+  if (Jitter_us)
+  { // Park-Miller, so that a run can be reproduced
+    Seed = (uint32_t)(((uint64_t)Seed * 48271UL) % 2147483647UL);
+    duration_us += Seed % (2UL * Jitter_us + 1);
+    duration_us = (duration_us > Jitter_us ? duration_us - Jitter_us : 0);
+  }
+  Time_us += duration_us;
+  return true;
+}
+
+boolean SyntheticPulseSource::Pulse(uint32_t high_us, uint32_t low_us)
+{
+  return Hold(1, high_us) && Hold(0, low_us);
+}
+
+boolean SyntheticPulseSource::Peek(uint32_t &time_us, uint8_t &level)
+{
+  return EdgeRing_Peek(&Ring, time_us, level);
+}
+
+void SyntheticPulseSource::Pop()
+{
+  EdgeRing_Pop(&Ring);
+}
+
+uint32_t SyntheticPulseSource::Now()
+{
+  return Time_us;
+}
+
+#ifndef ARDUINO
+ReplayPulseSource::ReplayPulseSource(FILE *file)
+{
+  File = file;
+  Pending = false;
+  Ended = false;
+  Time_us = 0;
+  Level = 0;
+}
+
+boolean ReplayPulseSource::Peek(uint32_t &time_us, uint8_t &level)
+{
+  char line[64];
+  unsigned long t;
+  unsigned int l;
+
+  while (!Pending && !Ended)
+  {
+    if (!fgets(line, sizeof(line), File))
+      Ended = true;
+    else if (sscanf(line, "%lu %u", &t, &l) == 2)
+    {
+      Time_us = t;
+      Level = (l ? 1 : 0);
+      Pending = true;
+    }
+  }
+  time_us = Time_us;
+  level = Level;
+  return Pending;
+}
+
+void ReplayPulseSource::Pop()
+{
+  Pending = false;
+}
+
+uint32_t ReplayPulseSource::Now()
+{
+  // Once the file is over, the last period lasts forever
+  return (Ended ? Time_us + 2UL * SIGNAL_END_TIMEOUT_US : Time_us);
+}
+#endif // ARDUINO
+
+// ***********************************************************************************
+// Packet buffer pool
+// Only touched from loop(), the interrupt never sees these buffers.
+// ***********************************************************************************
+static PackedSignalStruct *Pool_Acquire()
+{
+  for (byte i = 0; i < RAW_SIGNAL_POOL; i++)
+    if (Pool.State[i] == Pool_Free)
+    {
+      Pool.State[i] = Pool_Assembling;
+      return &PackedSignalPool[i];
+    }
+  return NULL;
+}
+
+static void Pool_Queue(PackedSignalStruct *packet)
+{
+  byte i = packet - PackedSignalPool;
+
+  Pool.State[i] = Pool_Ready;
+  Pool.Ready[(Pool.ReadyFirst + Pool.ReadyCount++) % RAW_SIGNAL_POOL] = i;
+}
+
+static PackedSignalStruct *Pool_Take()
+{
+  if (Pool.ReadyCount == 0)
+    return NULL;
+
+  byte i = Pool.Ready[Pool.ReadyFirst];
+  Pool.ReadyFirst = (Pool.ReadyFirst + 1) % RAW_SIGNAL_POOL;
+  Pool.ReadyCount--;
+  Pool.State[i] = Pool_Decoding;
+  return &PackedSignalPool[i];
+}
+
+void Capture_Release(PackedSignalStruct *packet)
+{
+  if ((packet >= PackedSignalPool) && (packet < PackedSignalPool + RAW_SIGNAL_POOL))
+    Pool.State[packet - PackedSignalPool] = Pool_Free;
+}
+
+// ***********************************************************************************
+// Packet assembler
+// ***********************************************************************************
+static inline uint8_t Assembler_Sample(uint32_t pulse_us)
+{
+  pulse_us /= RAWSIGNAL_SAMPLE_RATE;
+  return (pulse_us > 0xFF ? 0xFF : pulse_us);
+}
+
+static inline boolean Assembler_Store(uint32_t pulse_us)
+{
+  if (Assembler.Packet && !Packed_Store(Assembler.Packet, Assembler.RawCodeLength, Assembler_Sample(pulse_us)))
+    return false;
+  Assembler.RawCodeLength++;
+  return true;
+}
+
+void Assembler_Reset()
+{
+  Assembler.State = Capture_Seek;
+  Assembler.Synced = false;
+  Assembler.RawCodeLength = 0;
+}
+
+static boolean Assembler_End(boolean timeout)
+{
+  PackedSignalStruct *packet = Assembler.Packet;
+
+  Assembler.State = Capture_Seek;
+
+  if (timeout) // Ending pulse is part of the packet, as with the former polling capture. Its width is always known.
+    Assembler_Store(SIGNAL_END_TIMEOUT_US);
+
+  Stats_Length(Assembler.RawCodeLength - 1);
+  if (Assembler.RawCodeLength < MIN_RAW_PULSES)
+  {
+    SignalStats.Runts++;
+    return false; // Keep the buffer for the next one
+  }
+
+  if (!packet)
+  {
+    Capture_Dropped++;
+    return false;
+  }
+  packet->Number = Assembler.RawCodeLength - 1; // Number of received pulse times (pulsen *2)
+  packet->Repairs = Assembler.Repairs;
+  SignalStats.Captured++;
+  SignalStats.Repairs += Assembler.Repairs;
+  Pool_Queue(packet);
+  Assembler.Packet = NULL;
+  return true;
+}
+
+// When true is returned, the edge has not (or not only) been consumed and must be fed again,
+// it may well be the end of the preamble of the next packet.
+boolean Assembler_Edge(uint32_t time_us, uint8_t level)
+{
+  if (!Assembler.Synced)
+  {
+    Assembler.Synced = true;
+    Assembler.Level = level;
+    Assembler.LastEdge_us = time_us;
+    return false;
+  }
+
+  if (level == Assembler.Level)
+    return false; // No transition, spike was shorter than interrupt latency
+
+  uint32_t PulseLength_us = time_us - Assembler.LastEdge_us;
+
+  if (Assembler.State == Capture_Message)
+  {
+    if (PulseLength_us > SIGNAL_END_TIMEOUT_US)
+    { // ***   Ending Pulse Check   ***
+      if (Assembler_End(true))
+        return true;
+    }
+    else if (PulseLength_us < MIN_PULSE_LENGTH_US)
+    { // ***   Too short Pulse Check   ***
+      if (Assembler.Repairs < GLITCH_MAX_REPAIRS)
+      { // Spike: last stored pulse goes on, spike and next pulse will be added to it
+        Stats_Pulse(PulseLength_us);
+        Assembler.Repairs++;
+        Assembler.RawCodeLength--;
+        Assembler.Level = level;
+        Assembler.LastEdge_us = Assembler.PrevEdge_us;
+        if (Assembler.RawCodeLength == 0)
+          Assembler.State = Capture_Seek; // Right after the preamble: preamble goes on
+        return false;
+      }
+      SignalStats.Short++;
+      Assembler.State = Capture_Seek;
+    }
+    else if (!Assembler_Store(PulseLength_us))
+    { // ***   No room left for this pulse: a distinct length too many past PACKED_BYTE_PULSES, packet ends before it   ***
+      SignalStats.Full++;
+      if (Assembler_End(false))
+        return true;
+    }
+    else
+    { // ***   Store Pulse   ***
+      Stats_Pulse(PulseLength_us);
+      Assembler.PrevEdge_us = Assembler.LastEdge_us;
+      Assembler.Level = level;
+      Assembler.LastEdge_us = time_us;
+      if (Assembler.RawCodeLength >= (Assembler.Packet ? Packed_Capacity(Assembler.Packet) : PACKED_MAX_PULSES))
+      {
+        SignalStats.Full++;
+        return Assembler_End(false);
+      }
+      return false;
+    }
+  }
+
+  // ***   Scan for Preamble Pulse   ***
+  Stats_Pulse(PulseLength_us); // Edges fed again after the end of a packet are only counted here
+  if ((Assembler.Level == 0) && (PulseLength_us >= SIGNAL_MIN_PREAMBLE_US))
+  {
+    if (!Assembler.Packet)
+      Assembler.Packet = Pool_Acquire();
+    if (Assembler.Packet)
+      Packed_Reset(Assembler.Packet);
+    Assembler.RawCodeLength = 0;
+    Assembler.Repairs = 0;
+    Assembler_Store(PulseLength_us);
+    Assembler.PrevEdge_us = Assembler.LastEdge_us;
+    Assembler.State = Capture_Message;
+    SignalStats.Preambles++;
+  }
+  else
+    SignalStats.Noise++;
+
+  Assembler.Level = level;
+  Assembler.LastEdge_us = time_us;
+  return false;
+}
+
+boolean Assembler_Idle(uint32_t now_us)
+{
+  if (Assembler.State != Capture_Message)
+    return false;
+  // Signed difference: now_us may be older than an edge stored meanwhile
+  if ((int32_t)(now_us - Assembler.LastEdge_us) <= (int32_t)SIGNAL_END_TIMEOUT_US)
+    return false;
+  return Assembler_End(true);
+}
+
+PackedSignalStruct *Capture_Poll(PulseSource &source)
+{
+  static uint16_t LastOverruns = 0;
+  uint32_t time_us;
+  uint8_t level;
+
+  if (source.Overruns() != LastOverruns)
+  { // Edges were lost, timeline is broken: start over
+    LastOverruns = source.Overruns();
+    Assembler_Reset();
+  }
+
+  // Bounded, so that a noisy receiver can not keep us here forever
+  for (uint16_t n = 0; n < EDGE_BUFFER_SIZE; n++)
+  {
+    if (!source.Peek(time_us, level))
+    {
+      Assembler_Idle(source.Now());
+      break;
+    }
+    if (!Assembler.Packet && (Assembler.State == Capture_Seek))
+    {
+      Assembler.Packet = Pool_Acquire();
+      if (!Assembler.Packet && Pool.ReadyCount)
+        break; // Edges wait in the source until a queued packet is taken
+    }
+    if (!Assembler_Edge(time_us, level))
+      source.Pop();
+  }
+  return Pool_Take();
+}
+
+// ***********************************************************************************
+// RF data pin interrupt
+// ***********************************************************************************
+#if (defined(ESP32) || defined(ESP8266))
+void IRAM_ATTR Capture_ISR()
+{
+  EdgeRing_Push(&EdgeRing, micros(), digitalRead(PIN_RF_RX_DATA));
+}
+
+void Capture_Start()
+{
+  if (PIN_RF_RX_DATA == (uint8_t)NOT_A_PIN)
+    return;
+  EdgeRing_Reset(&EdgeRing);
+  Assembler_Reset();
+  attachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA), Capture_ISR, CHANGE);
+}
+
+void Capture_Stop()
+{
+  if (PIN_RF_RX_DATA == (uint8_t)NOT_A_PIN)
+    return;
+  detachInterrupt(digitalPinToInterrupt(PIN_RF_RX_DATA));
+}
+
+boolean LivePulseSource::Peek(uint32_t &time_us, uint8_t &level)
+{
+  return EdgeRing_Peek(&EdgeRing, time_us, level);
+}
+
+void LivePulseSource::Pop()
+{
+  EdgeRing_Pop(&EdgeRing);
+}
+
+uint32_t LivePulseSource::Now()
+{
+  return micros();
+}
+
+uint16_t LivePulseSource::Overruns()
+{
+  return EdgeRing.Overruns;
+}
+#endif // ESP32 || ESP8266
+#endif // __AVR__
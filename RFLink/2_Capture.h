@@ -0,0 +1,130 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Capture_h
+#define Capture_h
+
+#include "2_Signal.h"
+#include "2_Packed.h"
+
+#define EDGE_BUFFER_SIZE 512 // 512        // Edge timestamps buffered between RF interrupt and packet assembler. MUST be a power of 2.
+#define RAW_SIGNAL_POOL 2    // 2          // Packet buffers handed over from packet assembler to plugins. At least 2.
+
+// ***********************************************************************************
+// Edge ring buffer
+// Single producer (RF data pin interrupt) / single consumer (packet assembler in loop())
+// Each entry holds the micros() timestamp of a transition, bit 0 replaced by the new pin level.
+// ***********************************************************************************
+struct EdgeRingStruct
+{
+  volatile uint16_t Head;                    // Next slot to be written (producer only)
+  volatile uint16_t Tail;                    // Next slot to be read (consumer only)
+  volatile uint16_t Overruns;                // Edges dropped because the ring was full
+  volatile uint32_t Edges[EDGE_BUFFER_SIZE]; // Timestamp | level
+};
+
+extern EdgeRingStruct EdgeRing; // Fed by the RF data pin interrupt
+
+void EdgeRing_Reset(EdgeRingStruct *ring);
+boolean EdgeRing_Push(EdgeRingStruct *ring, uint32_t time_us, uint8_t level);
+boolean EdgeRing_Peek(EdgeRingStruct *ring, uint32_t &time_us, uint8_t &level);
+void EdgeRing_Pop(EdgeRingStruct *ring);
+
+// ***********************************************************************************
+// Pulse sources
+// Where the packet assembler gets its edges from: the RF data pin, a recorded edge timeline
+// or a programmed one. Timestamps are in uSec, level is the pin level after the edge.
+// ***********************************************************************************
+class PulseSource
+{
+public:
+  virtual boolean Peek(uint32_t &time_us, uint8_t &level) = 0; // Next edge, false when none is pending
+  virtual void Pop() = 0;                                       // Consume the edge returned by Peek()
+  virtual uint32_t Now() = 0;                                   // Current time, to detect the end of a packet from silence
+  virtual uint16_t Overruns() { return 0; }                     // Edges lost so far
+};
+
+#if (defined(ESP32) || defined(ESP8266))
+// RF data pin, through EdgeRing and Capture_ISR()
+class LivePulseSource : public PulseSource
+{
+public:
+  boolean Peek(uint32_t &time_us, uint8_t &level);
+  void Pop();
+  uint32_t Now();
+  uint16_t Overruns();
+};
+#endif
+
+// Programmed edge timeline, eg. a protocol frame with some jitter
+class SyntheticPulseSource : public PulseSource
+{
+public:
+  SyntheticPulseSource(uint32_t start_us = 0, uint16_t jitter_us = 0);
+  boolean Hold(uint8_t level, uint32_t duration_us); // Pin goes to level (edge if it changes) and stays there for duration_us
+  boolean Pulse(uint32_t high_us, uint32_t low_us);  // Hold(HIGH, high_us) then Hold(LOW, low_us)
+  boolean Peek(uint32_t &time_us, uint8_t &level);
+  void Pop();
+  uint32_t Now(); // End of the last programmed period
+
+private:
+  EdgeRingStruct Ring;
+  uint32_t Time_us;
+  uint16_t Jitter_us;
+  uint32_t Seed;
+  uint8_t Level;
+};
+
+#ifndef ARDUINO
+#include <stdio.h>
+
+// Recorded edge timeline, one "<time_us> <level>" per line, '#' starts a comment
+class ReplayPulseSource : public PulseSource
+{
+public:
+  ReplayPulseSource(FILE *file);
+  boolean Peek(uint32_t &time_us, uint8_t &level);
+  void Pop();
+  uint32_t Now(); // Last edge time while reading, far beyond once the file is over
+
+private:
+  FILE *File;
+  boolean Pending;
+  boolean Ended;
+  uint32_t Time_us;
+  uint8_t Level;
+};
+#endif
+
+// ***********************************************************************************
+// Packet buffer pool
+// A buffer is owned in turn by the assembler (filling), the ready queue, then the decoder
+// (plugins) until Capture_Release(). Capture goes on in another buffer meanwhile,
+// when none is free edges are left waiting in the PulseSource.
+// Buffers are packed (see 2_Packed.h), a packet ends when it is full.
+// ***********************************************************************************
+extern PackedSignalStruct PackedSignalPool[RAW_SIGNAL_POOL];
+extern unsigned long Capture_Dropped; // Complete packets lost because no buffer was free
+
+// ***********************************************************************************
+// Packet assembler
+// Same preamble / pulse / end-of-packet rules as the former busy-polling FetchSignal(),
+// driven by edge timestamps so it runs the same on any PulseSource.
+// ***********************************************************************************
+void Assembler_Reset();
+boolean Assembler_Edge(uint32_t time_us, uint8_t level); // true when a packet was queued
+boolean Assembler_Idle(uint32_t now_us);                 // true when silence has ended and queued a packet
+
+PackedSignalStruct *Capture_Poll(PulseSource &source); // Drain edges into the assembler, then take the oldest queued packet (or NULL)
+void Capture_Release(PackedSignalStruct *packet);     // Give a packet taken from Capture_Poll() back to the pool
+
+#if (defined(ESP32) || defined(ESP8266))
+void Capture_Start(); // Attach RF data pin interrupt
+void Capture_Stop();  // Detach RF data pin interrupt
+#endif
+
+#endif
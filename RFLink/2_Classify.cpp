@@ -0,0 +1,139 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include "2_Signal.h"
+#include "2_Classify.h"
+
+#if (CLASSIFY_LEVELS > 4)
+#error "CLASSIFY_LEVELS must be 4 at most"
+#endif
+
+PulseClassStruct PulseClass;
+
+void Classify_Pulses(const RawSignalStruct *signal, PulseClassStruct *classes)
+{
+  byte seen[32]; // One bit per pulse width
+  byte lower[CLASSIFY_LEVELS]; // Shortest width of each level
+  unsigned int sum[CLASSIFY_LEVELS];
+  byte levels = 0;
+  byte top = 0;
+
+  classes->Number = signal->Number;
+  classes->Time = signal->Time;
+  classes->Levels = 0;
+  classes->MarkMin = classes->SpaceMin = 0xFF;
+  classes->MarkMax = classes->SpaceMax = 0;
+  if (signal->Number < 2)
+    return;
+
+  // Widths present and mark/space bounds, the ending pulse aside
+  memset(seen, 0, sizeof(seen));
+  seen[signal->Pulses[1] >> 3] |= 1 << (signal->Pulses[1] & 7);
+  for (int i = 2; i < signal->Number; i++)
+  {
+    byte pulse = signal->Pulses[i];
+
+    seen[pulse >> 3] |= 1 << (pulse & 7);
+    if (i & 1)
+    {
+      if (pulse < classes->MarkMin)
+        classes->MarkMin = pulse;
+      if (pulse > classes->MarkMax)
+        classes->MarkMax = pulse;
+    }
+    else
+    {
+      if (pulse < classes->SpaceMin)
+        classes->SpaceMin = pulse;
+      if (pulse > classes->SpaceMax)
+        classes->SpaceMax = pulse;
+    }
+  }
+
+  // Levels, from the gaps between the widths
+  for (int width = 0; width < 256; width++)
+  {
+    if (!(seen[width >> 3] & (1 << (width & 7))))
+    {
+      if (!seen[width >> 3])
+        width |= 7; // Skip empty bytes
+      continue;
+    }
+    if (!levels || (width * 2 > top * CLASSIFY_GAP_RATIO))
+    {
+      if (levels == CLASSIFY_LEVELS)
+        return; // Too many widths, leave the packet to the plugins
+      lower[levels++] = width;
+    }
+    top = width;
+  }
+
+  memset(classes->Symbols, 0, sizeof(classes->Symbols));
+  memset(classes->Count, 0, sizeof(classes->Count));
+  memset(sum, 0, sizeof(sum));
+  for (byte level = 0; level < levels; level++)
+  {
+    classes->Min[level] = 0xFF;
+    classes->Max[level] = 0;
+  }
+
+  classes->Preamble = 0;
+  for (int i = 1; i <= signal->Number; i++)
+  {
+    byte pulse = signal->Pulses[i];
+    byte level = levels - 1;
+
+    while (level && (pulse < lower[level]))
+      level--;
+    classes->Symbols[i >> 2] |= level << ((i & 3) << 1);
+    if (i == 1)
+      classes->First = level;
+    if ((classes->Preamble == i - 1) && (level == classes->First))
+      classes->Preamble = (i < 255) ? i : 255;
+    classes->Last = level;
+    if (i == signal->Number)
+      break; // Ending pulse, not part of the statistics
+    if (pulse < classes->Min[level])
+      classes->Min[level] = pulse;
+    if (pulse > classes->Max[level])
+      classes->Max[level] = pulse;
+    classes->Count[level]++;
+    sum[level] += pulse;
+  }
+
+  for (byte level = 0; level < levels; level++)
+    classes->Avg[level] = sum[level] / classes->Count[level];
+  classes->Levels = levels;
+}
+
+byte Classify_Split(const RawSignalStruct *signal, byte mid)
+{
+  byte split = 0;
+  int best = 0x7FFF;
+
+  if ((PulseClass.Levels < 2) || !Classify_Describes(signal))
+    return 0;
+
+  // Gap between two levels nearest to mid
+  for (byte level = 1; level < PulseClass.Levels; level++)
+  {
+    int distance = ((PulseClass.Max[level - 1] + PulseClass.Min[level]) / 2) - mid;
+
+    if (distance < 0)
+      distance = -distance;
+    if (distance < best)
+    {
+      best = distance;
+      split = level;
+    }
+  }
+  return split;
+}
@@ -0,0 +1,75 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Classify_h
+#define Classify_h
+
+#include "2_Signal.h"
+
+#define CLASSIFY_LEVELS 4    // 4          // Pulse widths a packet is split in. MUST be 4 at most, symbols are 2 bits.
+#define CLASSIFY_GAP_RATIO 3 // 3          // In halves: a level starts at widths over 1.5 times the longest pulse of the level below
+
+// ***********************************************************************************
+// Shared pulse classifier
+// Run once on each packet before the plugins see it. Pulse widths are clustered in up to
+// CLASSIFY_LEVELS levels, wherever the packet has its gaps, and each pulse gets the index of
+// its level: 0 for the shortest. As levels follow the packet timing, they keep working
+// when a transmitter drifts, where the fixed thresholds of the plugins would not.
+// The ending pulse is not clustered, it only gets the nearest level below it.
+// The same pass gathers the features the dispatcher checks plugins against, see
+// Plugin_Shapes[] in 5_Plugin.cpp: marks and spaces are over pulses 2..Number-1, the first
+// pulse being a sync or start bit in most protocols, and the last one the ending pulse.
+// ***********************************************************************************
+struct PulseClassStruct
+{
+  int Number;                            // Pulses classified, as in RawSignal->Number
+  unsigned long Time;                    // RawSignal->Time of the packet classified
+  byte Levels;                           // Levels found, 0 when the packet has more than CLASSIFY_LEVELS
+  byte MarkMin;                          // Shortest mark (odd pulse), pulse 1 and the ending pulse aside
+  byte MarkMax;                          // Longest mark
+  byte SpaceMin;                         // Shortest space (even pulse)
+  byte SpaceMax;                         // Longest space
+  byte First;                            // Level of the first pulse, when Levels is set
+  byte Last;                             // Level of the ending pulse, when Levels is set
+  byte Preamble;                         // Pulses at the start in the level of the first one, when Levels is set
+  byte Min[CLASSIFY_LEVELS];             // Shortest pulse of each level, in RAWSIGNAL_SAMPLE_RATE units
+  byte Max[CLASSIFY_LEVELS];             // Longest pulse of each level
+  byte Avg[CLASSIFY_LEVELS];             // Average pulse of each level
+  unsigned int Count[CLASSIFY_LEVELS];   // Pulses in each level
+  byte Symbols[(RAW_BUFFER_SIZE + 4) / 4]; // Level of pulses 1..Number, 2 bits each, low bits first
+};
+
+extern PulseClassStruct PulseClass; // Classes of the packet being decoded
+
+void Classify_Pulses(const RawSignalStruct *signal, PulseClassStruct *classes);
+
+// PulseClass was computed from signal, and not from an earlier packet
+inline boolean Classify_Describes(const RawSignalStruct *signal)
+{
+  return (PulseClass.Number == signal->Number) && (PulseClass.Time == signal->Time);
+}
+
+// Level of pulse i
+inline byte Classify_Symbol(const PulseClassStruct *classes, int i)
+{
+  return (classes->Symbols[i >> 2] >> ((i & 3) << 1)) & 3;
+}
+
+// For plugins: first level above their own threshold mid, in the packet PulseClass describes.
+// Pulses of that level or higher are "long". 0 when PulseClass does not describe signal
+// with at least two levels: the plugin then compares its raw pulses with mid.
+byte Classify_Split(const RawSignalStruct *signal, byte mid);
+
+// Pulse i is long: from its level when split is set, from its width otherwise
+inline boolean Classify_IsLong(const RawSignalStruct *signal, int i, byte split, byte mid)
+{
+  if (split)
+    return Classify_Symbol(&PulseClass, i) >= split;
+  return signal->Pulses[i] > mid;
+}
+
+#endif
@@ -0,0 +1,82 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include "2_Signal.h"
+#include "2_Packed.h"
+
+#if (PACKED_MAX_PULSES & 1)
+#error "PACKED_MAX_PULSES must be even"
+#endif
+
+void Packed_Reset(PackedSignalStruct *packet)
+{
+  packet->Number = 0;
+  packet->Repairs = 0;
+  packet->Widths = 1;
+  packet->Width[0] = SIGNAL_END_TIMEOUT_US / RAWSIGNAL_SAMPLE_RATE;
+}
+
+// Pulses 0..count-1 from 4 bit symbols to a byte each, in place: from the last one, as
+// byte i is only written once the symbols it held (2i and 2i + 1) have been read
+static void Packed_Expand(PackedSignalStruct *packet, int count)
+{
+  for (int i = count - 1; i >= 0; i--)
+    packet->Symbols[i] = Packed_Pulse(packet, i);
+  packet->Widths = 0;
+}
+
+boolean Packed_Store(PackedSignalStruct *packet, unsigned int i, byte sample)
+{
+  byte symbol = 0;
+
+  if (i >= Packed_Capacity(packet))
+    return false;
+  if (!packet->Widths)
+  {
+    packet->Symbols[i] = sample;
+    return true;
+  }
+
+  while ((symbol < packet->Widths) && (packet->Width[symbol] != sample))
+    symbol++;
+  if (symbol == packet->Widths)
+  {
+    if (symbol == PACKED_WIDTHS)
+    { // One distinct length too many: a byte per pulse from now on
+      if (i >= PACKED_BYTE_PULSES)
+        return false;
+      Packed_Expand(packet, i);
+      packet->Symbols[i] = sample;
+      return true;
+    }
+    packet->Width[packet->Widths++] = sample;
+  }
+
+  byte *slot = &packet->Symbols[i >> 1];
+  if (i & 1)
+    *slot = (*slot & 0x0F) | (symbol << 4);
+  else
+    *slot = (*slot & 0xF0) | symbol;
+  return true;
+}
+
+void Packed_Unpack(const PackedSignalStruct *packet, int start, int length, RawSignalStruct *frame)
+{
+  frame->Pulses[0] = 0; // Not routed to a plugin yet, see PluginRX_Rewrite()
+  for (int i = 0; i < length; i++)
+    frame->Pulses[i + 1] = Packed_Pulse(packet, start + i);
+  frame->Pulses[length + 1] = 0; // Last element contains the timeout.
+  frame->Number = length;
+  frame->Multiply = RAWSIGNAL_SAMPLE_RATE;
+  frame->Repairs = packet->Repairs;
+  frame->Time = packet->Time;
+  frame->Repeats = 0;
+  frame->Delay = 0;
+}
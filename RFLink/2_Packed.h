@@ -0,0 +1,56 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Packed_h
+#define Packed_h
+
+#include "2_Signal.h"
+
+#define PACKED_MAX_PULSES (2u * RAW_BUFFER_SIZE) // 584 // Pulses held by a capture buffer, preamble included. MUST be even.
+#define PACKED_WIDTHS 16                         // 16         // Distinct pulse lengths in one packet, one 4 bit symbol each
+
+// ***********************************************************************************
+// Packed pulse storage
+// A packet only uses a handful of distinct pulse lengths, even with jitter. Each one is
+// stored once in Width[], exactly as it was sampled, and each pulse is a 4 bit index in
+// that table: twice the pulses of a RawSignalStruct in the same RAM, nothing rounded.
+// Width[0] is always the end of packet timeout, so the ending pulse is never refused.
+// A packet with more distinct lengths than Width[] holds goes on a byte per pulse, as
+// sampled: Symbols[] then holds PACKED_BYTE_PULSES pulses, as many as a RawSignalStruct.
+// Plugins get frames unpacked into a RawSignalStruct by Packed_Unpack(), see ScanEvent().
+// ***********************************************************************************
+#define PACKED_BYTE_PULSES (PACKED_MAX_PULSES / 2)
+
+struct PackedSignalStruct
+{
+  int Number;                                // Number of pulses, as in RawSignalStruct: Pulses 1..Number, 0 is the preamble
+  byte Repairs;                              // Spikes merged into their neighbours while receiving
+  unsigned long Time;                        // Timestamp indicating when the signal was received (millis())
+  byte Widths;                               // Entries used in Width[], 0 once pulses are stored a byte each
+  byte Width[PACKED_WIDTHS];                 // Pulse lengths in RAWSIGNAL_SAMPLE_RATE units
+  byte Symbols[PACKED_MAX_PULSES / 2];       // Index in Width[] of each pulse, low nibble first. Or its length, when Widths is 0
+};
+
+// Length of pulse i, in RAWSIGNAL_SAMPLE_RATE units
+inline byte Packed_Pulse(const PackedSignalStruct *packet, int i)
+{
+  if (!packet->Widths)
+    return packet->Symbols[i];
+  return packet->Width[(packet->Symbols[i >> 1] >> ((i & 1) << 2)) & 0x0F];
+}
+
+// Pulses the packet can hold
+inline unsigned int Packed_Capacity(const PackedSignalStruct *packet)
+{
+  return packet->Widths ? PACKED_MAX_PULSES : PACKED_BYTE_PULSES;
+}
+
+void Packed_Reset(PackedSignalStruct *packet);
+boolean Packed_Store(PackedSignalStruct *packet, unsigned int i, byte sample); // false when pulse i is beyond the capacity
+void Packed_Unpack(const PackedSignalStruct *packet, int start, int length, RawSignalStruct *frame); // Pulses[start..start+length-1] as frame Pulses[1..length]
+
+#endif
@@ -0,0 +1,134 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include "2_Signal.h"
+#include "2_Segment.h"
+
+#define SEGMENT_MAX_GAPS (SEGMENT_MAX_FRAMES + 1)
+
+// Same split for both storages, pulses are only read through these
+static inline byte Segment_Pulse(const RawSignalStruct *packet, int i)
+{
+  return packet->Pulses[i];
+}
+
+static inline byte Segment_Pulse(const PackedSignalStruct *packet, int i)
+{
+  return Packed_Pulse(packet, i);
+}
+
+// ***********************************************************************************
+// Median pulse length in samples, from a coarse histogram (4 samples wide bins)
+// ***********************************************************************************
+template <class Signal>
+static byte Segment_Median(const Signal *packet)
+{
+  uint16_t histogram[64];
+  int half = (packet->Number - 1) / 2;
+
+  memset(histogram, 0, sizeof(histogram));
+  for (int i = 1; i < packet->Number; i++)
+    histogram[Segment_Pulse(packet, i) >> 2]++;
+
+  for (byte bin = 0; bin < 64; bin++)
+  {
+    half -= histogram[bin];
+    if (half < 0)
+      return (bin << 2) + 2;
+  }
+  return 0xFF;
+}
+
+template <class Signal>
+static byte Segment_Find(const Signal *packet, SegmentStruct *segments)
+{
+  int gaps[SEGMENT_MAX_GAPS];
+  byte gap_count = 0;
+  uint16_t threshold;
+
+  segments->Count = 0;
+  if (packet->Number < SEGMENT_MIN_PULSES)
+    return 0;
+
+  threshold = (uint16_t)Segment_Median(packet) * SEGMENT_GAP_RATIO;
+  if (threshold < SEGMENT_MIN_GAP_US / RAWSIGNAL_SAMPLE_RATE)
+    threshold = SEGMENT_MIN_GAP_US / RAWSIGNAL_SAMPLE_RATE;
+
+  // The packet starts after a silence, so the first frame starts right after a gap too
+  gaps[gap_count++] = 0;
+  for (int i = 1; i <= packet->Number; i++)
+    if (Segment_Pulse(packet, i) >= threshold)
+    {
+      if (gap_count == SEGMENT_MAX_GAPS)
+        return 0; // Too many gaps for frames any plugin would decode, not a repeat burst
+      gaps[gap_count++] = i;
+    }
+
+  // Frame length seen most often between consecutive gaps
+  int length = 0;
+  byte best = 1;
+  for (byte g = 1; g < gap_count; g++)
+  {
+    int l = gaps[g] - gaps[g - 1];
+    byte seen = 0;
+
+    if ((l < SEGMENT_MIN_FRAME) || (l == length))
+      continue;
+    for (byte h = g; h < gap_count; h++)
+      if (gaps[h] - gaps[h - 1] == l)
+        seen++;
+    if (seen > best)
+    {
+      best = seen;
+      length = l;
+    }
+  }
+  if (!length)
+    return 0; // No frame repeated
+
+  segments->Length = length;
+  for (byte g = 1; g < gap_count; g++)
+    if (gaps[g] - gaps[g - 1] == length)
+      segments->Start[segments->Count++] = gaps[g - 1] + 1;
+  return segments->Count;
+}
+
+byte Segment_Split(const RawSignalStruct *packet, SegmentStruct *segments)
+{
+  return Segment_Find(packet, segments);
+}
+
+byte Segment_Split(const PackedSignalStruct *packet, SegmentStruct *segments)
+{
+  return Segment_Find(packet, segments);
+}
+
+void Segment_Copy(const RawSignalStruct *packet, const SegmentStruct *segments, byte index, RawSignalStruct *frame)
+{
+  int start = segments->Start[index];
+  int length = segments->Length;
+
+  memmove(&frame->Pulses[1], &packet->Pulses[start], length);
+  frame->Pulses[length + 1] = 0;
+  frame->Pulses[0] = 0; // Not routed to a plugin yet, see PluginRX_Rewrite()
+  frame->Number = length;
+  frame->Multiply = packet->Multiply;
+  frame->Repairs = packet->Repairs;
+  frame->Time = packet->Time;
+  frame->Delay = 0;
+  frame->Repeats = segments->Count; // Copies of the frame in the burst
+}
+
+void Segment_Copy(const PackedSignalStruct *packet, const SegmentStruct *segments, byte index, RawSignalStruct *frame)
+{
+  Packed_Unpack(packet, segments->Start[index], segments->Length, frame);
+  frame->Repeats = segments->Count; // Copies of the frame in the burst
+}
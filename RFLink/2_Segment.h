@@ -0,0 +1,40 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Segment_h
+#define Segment_h
+
+#include "2_Signal.h"
+#include "2_Packed.h"
+
+#define SEGMENT_MIN_PULSES (RAW_BUFFER_SIZE - 1) // 291 // Only packets this long are split. Plugins expect their own repeats in shorter ones.
+#define SEGMENT_MIN_GAP_US 2400                 // 2400       // Shortest gap between two frames of a repeat burst
+#define SEGMENT_GAP_RATIO 4                     // 4          // A gap is also at least that many times the median pulse of the packet
+#define SEGMENT_MIN_FRAME 24                    // 24         // Shorter frames are not decoded by any plugin
+#define SEGMENT_MAX_FRAMES (PACKED_MAX_PULSES / SEGMENT_MIN_FRAME)
+
+// ***********************************************************************************
+// Repeat burst segmenter
+// Sensors often send their frame several times with gaps shorter than SIGNAL_END_TIMEOUT_US,
+// filling the capture buffer with one oversized packet. Gaps are pulses far longer than the
+// typical pulse of the packet, a burst is a run of gaps spaced by the same number of pulses.
+// Each frame is given with the gap that ends it, as Pulses[1..Length]. Pulses[0] is 0, as
+// in a captured packet: plugins read it as the id of the plugin a packet is routed to.
+// ***********************************************************************************
+struct SegmentStruct
+{
+  byte Count;                       // Complete frames found, 0 when the packet is not a repeat burst
+  int Length;                       // Pulses in each frame, ending gap included
+  int Start[SEGMENT_MAX_FRAMES];    // Index of the first pulse of each frame
+};
+
+byte Segment_Split(const RawSignalStruct *packet, SegmentStruct *segments);
+byte Segment_Split(const PackedSignalStruct *packet, SegmentStruct *segments);
+void Segment_Copy(const RawSignalStruct *packet, const SegmentStruct *segments, byte index, RawSignalStruct *frame); // frame may be packet itself for index 0
+void Segment_Copy(const PackedSignalStruct *packet, const SegmentStruct *segments, byte index, RawSignalStruct *frame);
+
+#endif
@@ -8,136 +8,131 @@
 #include <Arduino.h>
 #include "1_Radio.h"
 #include "2_Signal.h"
+#include "2_Capture.h"
+#include "2_Classify.h"
+#include "2_Packed.h"
+#include "2_Segment.h"
+#include "2_Stats.h"
 #include "5_Plugin.h"
 
-RawSignalStruct RawSignal = {0, 0, 0, 0, 0UL};
-unsigned long SignalCRC = 0L;   // holds the bitstream value for some plugins to identify RF repeats
-unsigned long SignalCRC_1 = 0L; // holds the previous SignalCRC (for mixed burst protocols)
-byte SignalHash = 0L;           // holds the processed plugin number
-byte SignalHashPrevious = 0L;   // holds the last processed plugin number
-unsigned long RepeatingTimer = 0L;
+RawSignalStruct RawSignal = {0, 0, 0, 0, 0, 0UL};
 
 /*********************************************************************************************/
 boolean ScanEvent(void)
-{ // Deze routine maakt deel uit van de hoofdloop en wordt iedere 125uSec. doorlopen
-  unsigned long Timer = millis() + SCAN_HIGH_TIME_MS;
-
-  while (Timer > millis()) // || RepeatingTimer > millis())
-  {
-    // delay(1); // For Modem Sleep
-    if (FetchSignal())
-    { // RF: *** data start ***
-      if (PluginRXCall(0, 0))
-      { // Check all plugins to see which plugin can handle the received signal.
-        RepeatingTimer = millis() + SIGNAL_REPEAT_TIME_MS;
-        return true;
-      }
-    }
-  } // while
-  return false;
-}
-
-#if (defined(ESP32) || defined(ESP8266))
-// ***********************************************************************************
-boolean FetchSignal()
 {
-  // *********************************************************************************
-  static bool Toggle;
-  static unsigned long timeStartSeek_ms;
-  static unsigned long timeStartLoop_us;
-  static unsigned int RawCodeLength;
-  static unsigned long PulseLength_us;
-  static const bool Start_Level = LOW;
-  // *********************************************************************************
-
-#define RESET_SEEKSTART timeStartSeek_ms = millis();
-#define RESET_TIMESTART timeStartLoop_us = micros();
-#define CHECK_RF ((digitalRead(PIN_RF_RX_DATA) == Start_Level) ^ Toggle)
-#define CHECK_TIMEOUT ((millis() - timeStartSeek_ms) < SIGNAL_SEEK_TIMEOUT_MS)
-#define GET_PULSELENGTH PulseLength_us = micros() - timeStartLoop_us
-#define SWITCH_TOGGLE Toggle = !Toggle
-#define STORE_PULSE RawSignal.Pulses[RawCodeLength++] = PulseLength_us / RAWSIGNAL_SAMPLE_RATE
-
-  // ***   Init Vars   ***
-  Toggle = true;
-  RawCodeLength = 0;
-  PulseLength_us = 0;
-
-  // ***********************************
-  // ***   Scan for Preamble Pulse   ***
-  // ***********************************
-  RESET_SEEKSTART;
-
-  while (PulseLength_us < SIGNAL_MIN_PREAMBLE_US)
+#if (defined(ESP32) || defined(ESP8266))
+  static PackedSignalStruct *Burst = NULL; // Packet split in frames, kept until each frame went through the plugins
+  static SegmentStruct Segments;
+  static byte NextFrame;
+  static RawSignalStruct Frame; // What the plugins decode, unpacked from the capture buffer
+  static unsigned long QuietUntil;
+  static int QuietNumber = 0; // Length of the last packet decoded, 0 when no quiet window is open
+
+  // Edges are captured under interrupt, nothing to wait for here: give the CPU back to loop()
+  if (!Burst)
   {
-    while (CHECK_RF && CHECK_TIMEOUT)
-      ;
-    RESET_TIMESTART;
-    SWITCH_TOGGLE;
-    while (CHECK_RF && CHECK_TIMEOUT)
-      ;
-    GET_PULSELENGTH;
-    SWITCH_TOGGLE;
-    if (!CHECK_TIMEOUT)
+    PackedSignalStruct *packet = FetchSignal();
+    if (!packet)
       return false;
-  }
-  //Serial.print ("PulseLength: "); Serial.println (PulseLength);
-  STORE_PULSE;
-
-  // ************************
-  // ***   Message Loop   ***
-  // ************************
-  while (RawCodeLength < RAW_BUFFER_SIZE)
-  {
-
-    // ***   Time Pulse   ***
-    RESET_TIMESTART;
-    while (CHECK_RF)
+    if (Segment_Split(packet, &Segments) && PluginRXAccepts(Segments.Length))
     {
-      GET_PULSELENGTH;
-      if (PulseLength_us > SIGNAL_END_TIMEOUT_US)
-        break;
+      Burst = packet;
+      NextFrame = 0;
     }
-
-    // ***   Too short Pulse Check   ***
-    if (PulseLength_us < MIN_PULSE_LENGTH_US)
-    {
-      // NO RawCodeLength++;
-      return false; // Or break; instead, if you think it may worth it.
+    else
+    { // As much of the packet as plugins can take
+      Packed_Unpack(packet, 1, (packet->Number < RAW_BUFFER_SIZE ? packet->Number : RAW_BUFFER_SIZE - 1), &Frame);
+      Capture_Release(packet);
     }
-
-    // ***   Ending Pulse Check   ***
-    if (PulseLength_us > SIGNAL_END_TIMEOUT_US) // Again, in main while this time
+  }
+  if (Burst)
+  { // One frame per call, as there is only one message to send afterwards
+    Segment_Copy(Burst, &Segments, NextFrame++, &Frame);
+    if (NextFrame >= Segments.Count)
     {
-      RawCodeLength++;
-      break;
+      Capture_Release(Burst);
+      Burst = NULL;
     }
+  }
 
-    // ***   Prepare Next   ***
-    SWITCH_TOGGLE;
-
-    // ***   Store Pulse   ***
-    STORE_PULSE;
+  // RF: *** data start ***
+  if (!PluginRXAccepts(Frame.Number)) // Skip noise of a length no plugin decodes
+  {
+    SignalStats.Skipped++;
+    return false;
   }
-  //Serial.print ("RawCodeLength: ");
-  //Serial.println (RawCodeLength);
 
-  if (RawCodeLength >= MIN_RAW_PULSES)
+  // Quiet window: a decoded packet is sent several times in a row, all copies of the same length.
+  // Those are not decoded again until the window is over, or another length shows up.
+  if (QuietNumber)
   {
-    RawSignal.Pulses[RawCodeLength] = 0;  // Last element contains the timeout.
-    RawSignal.Number = RawCodeLength - 1; // Number of received pulse times (pulsen *2)
-    RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE;
-    RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
-    //Serial.print ("D");
-    //Serial.print (RawCodeLength);
-    return true;
+    if ((Frame.Number == QuietNumber) && ((long)(Frame.Time - QuietUntil) < 0))
+    {
+      SignalStats.Quiet++;
+      return false;
+    }
+    QuietNumber = 0;
   }
-  else
+
+  Classify_Pulses(&Frame, &PulseClass);
+  if (PluginRXCall(0, &Frame)) // Check all plugins to see which plugin can handle the received signal.
   {
-    RawSignal.Number = 0;
+    SignalStats.Decoded++;
+    if ((PluginResult.Quiet || Frame.Repeats) && PluginResult.Quiet_ms) // Asked by the plugin, or a frame split from a burst
+    {
+      QuietNumber = Frame.Number;
+      QuietUntil = Frame.Time + PluginResult.Quiet_ms;
+    }
+    return true;
   }
+  return false;
+#else
+  // Deze routine maakt deel uit van de hoofdloop en wordt iedere 125uSec. doorlopen
+  // Polls the receiver until a packet comes or SCAN_HIGH_TIME_MS is over, and returns after
+  // that one packet: a call never takes longer than SCAN_BUDGET_MS, the budget of the RF task.
+  unsigned long Timer = millis() + SCAN_HIGH_TIME_MS;
+  SegmentStruct Segments;
 
+  while (Timer > millis())
+  {
+    // delay(1); // For Modem Sleep
+    if (FetchSignal())
+    { // RF: *** data start ***
+      RawSignal.Pulses[0] = 0; // Not routed to a plugin yet, see PluginRX_Rewrite()
+      if (Segment_Split(&RawSignal, &Segments) && PluginRXAccepts(Segments.Length)) // No room for a second buffer: keep the first frame only
+        Segment_Copy(&RawSignal, &Segments, 0, &RawSignal);
+      if (!PluginRXAccepts(RawSignal.Number))
+      {
+        SignalStats.Skipped++;
+        return false;
+      }
+      Classify_Pulses(&RawSignal, &PulseClass);
+      if (PluginRXCall(0, &RawSignal))
+      { // Check all plugins to see which plugin can handle the received signal.
+        SignalStats.Decoded++;
+        RawSignal.Repeats = (PluginResult.Quiet || RawSignal.Repeats) && PluginResult.Quiet_ms; // FetchSignal() skips the copies
+        return true;
+      }
+      return false;
+    }
+  } // while
+  SignalStats.Timeouts++;
   return false;
+#endif
+}
+
+#if (defined(ESP32) || defined(ESP8266))
+// ***********************************************************************************
+PackedSignalStruct *FetchSignal()
+{
+  // RF data pin transitions are queued by Capture_ISR() (see 2_Capture.cpp),
+  // here we only turn the queued edges into packets, never blocking on the receiver.
+  static LivePulseSource RFPin;
+  PackedSignalStruct *packet = Capture_Poll(RFPin);
+
+  if (packet)
+    packet->Time = millis(); // Time the RF packet was received (to keep track of retransmits
+  return packet;
 }
 #endif
 // ***********************************************************************************
@@ -219,12 +214,25 @@ boolean FetchSignal()
 
       PulseLength = ((numloops + Overhead) * 1000UL) / LoopsPerMilli; // Contains pulselength in microseconds
       if (PulseLength < MIN_PULSE_LENGTH_US)
+      {
+        SignalStats.Short++;
         break; // Pulse length too short
+      }
       Ftoggle = !Ftoggle;
       RawSignal.Pulses[RawCodeLength++] = PulseLength / (unsigned long)(RAWSIGNAL_SAMPLE_RATE); // store in RawSignal !!!!
     } while (RawCodeLength < RAW_BUFFER_SIZE && numloops <= maxloops);                          // For as long as there is space in the buffer, no timeout etc.
+
+    // Statistics once the pulses are in, not to slow down the loop above
+    SignalStats.Preambles++;
+    if (RawCodeLength >= RAW_BUFFER_SIZE)
+      SignalStats.Full++;
+    for (unsigned int x = 1; x < RawCodeLength; x++)
+      Stats_Pulse(RawSignal.Pulses[x] * (unsigned long)(RAWSIGNAL_SAMPLE_RATE));
+    Stats_Length(RawCodeLength - 1);
+
     if (RawCodeLength >= MIN_RAW_PULSES)
     {
+      SignalStats.Captured++;
       RawSignal.Repeats = 0;                      // No repeats
       RawSignal.Multiply = RAWSIGNAL_SAMPLE_RATE; // Sample size.
       RawSignal.Number = RawCodeLength - 1;       // Number of received pulse times (pulsen *2)
@@ -234,6 +242,7 @@ boolean FetchSignal()
     }
     else
     {
+      SignalStats.Runts++;
       RawSignal.Number = 0;
     }
   }
@@ -0,0 +1,41 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include <string.h>
+#include "2_Signal.h"
+#include "2_Stats.h"
+
+SignalStatsStruct SignalStats;
+
+void Stats_Reset()
+{
+  memset(&SignalStats, 0, sizeof(SignalStats));
+}
+
+#ifdef STATS_HISTOGRAMS
+static inline byte Stats_Log2(uint32_t value)
+{
+  byte bin = 0;
+
+  while ((value >>= 1) && (bin < STATS_BINS - 1))
+    bin++;
+  return bin;
+}
+
+void Stats_Pulse(uint32_t pulse_us)
+{
+  SignalStats.PulseLog2[Stats_Log2(pulse_us)]++;
+}
+
+void Stats_Length(unsigned int pulses)
+{
+  SignalStats.LengthLog2[Stats_Log2(pulses)]++;
+}
+#endif
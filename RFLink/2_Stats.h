@@ -0,0 +1,53 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Stats_h
+#define Stats_h
+
+#include "2_Signal.h"
+
+#if (defined(ESP32) || defined(ESP8266))
+#define STATS_HISTOGRAMS // ESP only, 128 bytes an AVR cannot spare
+#define STATS_BINS 16    // 16         // log2 histogram bins, last one also counts anything larger
+#endif
+
+// ***********************************************************************************
+// Receive statistics
+// Plain counters bumped along the capture path, to see why packets are missed
+// and tune receiver placement and SIGNAL_* values. Dumped by 10;STATS;
+// ***********************************************************************************
+struct SignalStatsStruct
+{
+  unsigned long Timeouts;               // Preamble seek windows (SCAN_HIGH_TIME_MS) over without a packet, AVR polling only
+  unsigned long Noise;                  // Pulses seen while seeking a preamble, ESP only
+  unsigned long Preambles;              // Packets started
+  unsigned long Short;                  // Packets aborted by a pulse shorter than MIN_PULSE_LENGTH_US
+  unsigned long Full;                   // Packets truncated because the buffer was full
+  unsigned long Runts;                  // Packets shorter than MIN_RAW_PULSES
+  unsigned long Captured;               // Packets handed over to decoding
+  unsigned long Repairs;                // Spikes merged into their neighbours
+  unsigned long Skipped;                // Packets or frames of a length no enabled plugin decodes
+  unsigned long Quiet;                  // Repeats not decoded again, within the quiet window of the previous decode. ESP only
+  unsigned long Decoded;                // Packets or frames a plugin reported
+#ifdef STATS_HISTOGRAMS
+  unsigned long PulseLog2[STATS_BINS];  // Pulses by log2 of their length in uSec, eg. [9] is 512..1023 uSec
+  unsigned long LengthLog2[STATS_BINS]; // Ended packets by log2 of their pulse count, eg. [6] is 64..127 pulses
+#endif
+};
+
+extern SignalStatsStruct SignalStats;
+
+void Stats_Reset();
+#ifdef STATS_HISTOGRAMS
+void Stats_Pulse(uint32_t pulse_us);
+void Stats_Length(unsigned int pulses);
+#else
+inline void Stats_Pulse(uint32_t) {}
+inline void Stats_Length(unsigned int) {}
+#endif
+
+#endif
@@ -8,15 +8,33 @@
 #include <Arduino.h>
 #include "RFLink.h"
 #include "1_Radio.h"
+#include "2_Stats.h"
+#if (defined(ESP32) || defined(ESP8266))
+#include "2_Capture.h"
+#endif
 #include "3_Serial.h"
 #include "4_Display.h"
+#include "4_Event.h"
+#include "4_Queue.h"
 #include "5_Plugin.h"
+#include "6_WiFi_MQTT.h"
+#include "7_Scheduler.h"
 
 char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+boolean SerialBinary = false;
 
 boolean ReadSerial();
 boolean CheckCmd();
 boolean CopySerial(char *);
+void display_Stats();
+#ifdef TASK_STATS
+void display_Tasks();
+#endif
+void display_Plugins();
+#if (defined(ESP32) || defined(ESP8266))
+void display_Order();
+void display_PluginStats();
+#endif
 /*********************************************************************************************/
 
 boolean CheckSerial()
@@ -226,6 +244,117 @@ boolean CheckCmd()
           display_Footer();
         }
       }
+      else if (strcasecmp(InputBuffer_Serial + 3, "SERIAL=BINARY;") == 0)
+      {
+        SerialBinary = true;
+        Event_FrameReset(); // Names are sent again for the host that asks
+        display_Header();
+        display_Name(PSTR("SERIAL=BINARY"));
+        display_Footer();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "SERIAL=TEXT;") == 0)
+      {
+        SerialBinary = false;
+        display_Header();
+        display_Name(PSTR("SERIAL=TEXT"));
+        display_Footer();
+      }
+#ifdef MQTT_ENABLED
+      else if (strcasecmp(InputBuffer_Serial + 3, "MQTT=JSON;") == 0)
+      {
+        MQTT_JSON = true;
+        display_Header();
+        display_Name(PSTR("MQTT=JSON"));
+        display_Footer();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "MQTT=TEXT;") == 0)
+      {
+        MQTT_JSON = false;
+        display_Header();
+        display_Name(PSTR("MQTT=TEXT"));
+        display_Footer();
+      }
+#endif
+      else if (strcasecmp(InputBuffer_Serial + 3, "STATS;") == 0)
+      {
+        display_Stats();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "STATS;RESET;") == 0)
+      {
+        Stats_Reset();
+#if (defined(ESP32) || defined(ESP8266))
+        Capture_Dropped = 0;
+#endif
+        Msg.Overflows = 0;
+        Queue_ResetStats();
+        display_Header();
+        display_Name(PSTR("STATS;RESET"));
+        display_Footer();
+      }
+#ifdef TASK_STATS
+      else if (strcasecmp(InputBuffer_Serial + 3, "TASKS;") == 0)
+      {
+        display_Tasks();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "TASKS;RESET;") == 0)
+      {
+        Task_ResetStats();
+        display_Header();
+        display_Name(PSTR("TASKS;RESET"));
+        display_Footer();
+      }
+#endif
+      else if (strcasecmp(InputBuffer_Serial + 3, "PLUGINS;") == 0)
+      {
+        display_Plugins();
+      }
+      else if (strncasecmp(InputBuffer_Serial + 3, "PLUGIN=", 7) == 0)
+      {
+        char *end;
+        long id = strtol(InputBuffer_Serial + 10, &end, 10);
+        byte x = ((end > InputBuffer_Serial + 10) && (id >= 0) && (id < 255)) ? Plugin_Slot(id) : Plugin_Count;
+        boolean on = (strcasecmp(end, ";ON;") == 0);
+
+        if ((x == Plugin_Count) || (!on && (strcasecmp(end, ";OFF;") != 0)))
+          ValidCommand = 2;
+        else
+        {
+          char text[12];
+
+          Plugin_Enable(x, on);
+          sprintf_P(text, PSTR("PLUGIN=%03u"), Plugin_Id(x));
+          display_Header();
+          Msg.Name(text);
+          display_Name(on ? PSTR("ON") : PSTR("OFF"));
+          if (!PluginStateSave())
+            display_Name(PSTR("NOT SAVED"));
+          display_Footer();
+        }
+      }
+#if (defined(ESP32) || defined(ESP8266))
+      else if (strcasecmp(InputBuffer_Serial + 3, "PLUGINORDER;") == 0)
+      {
+        display_Order();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "PLUGINORDER;RESET;") == 0)
+      {
+        PluginRXOrderReset();
+        display_Header();
+        display_Name(PSTR("PLUGINORDER;RESET"));
+        display_Footer();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "PLUGINSTATS;") == 0)
+      {
+        display_PluginStats();
+      }
+      else if (strcasecmp(InputBuffer_Serial + 3, "PLUGINSTATS;RESET;") == 0)
+      {
+        PluginStatsReset();
+        display_Header();
+        display_Name(PSTR("PLUGINSTATS;RESET"));
+        display_Footer();
+      }
+#endif
       else if (strncasecmp(InputBuffer_Serial + 3, "VERSION", 7) == 0)
       {
         display_Header();
@@ -263,3 +392,275 @@ boolean CheckCmd()
 }
 
 /*********************************************************************************************/
+
+// Value of a 10;STATS; message, dropped rather than overflowing pbuffer (footer included): false then
+boolean display_Stat(const char *label, unsigned long value)
+{
+  return Msg.Dec(label, value, 1);
+}
+
+// As display_Stat(), label built in RAM: a plugin number or a histogram bin
+boolean display_Count(const char *label, unsigned long value)
+{
+  size_t start = Msg.Length;
+
+  return Msg.Commit(start, Msg.PutChar(';') && Msg.Put(label) && Msg.PutChar('=') && Msg.PutNumber(value, 10, 1));
+}
+
+#ifdef STATS_HISTOGRAMS
+// Non empty bins of a log2 histogram, as <tag><log2>=<count>
+void display_Histogram(char tag, const unsigned long *bins)
+{
+  char label[4];
+
+  for (byte bin = 0; bin < STATS_BINS; bin++)
+    if (bins[bin])
+    {
+      sprintf_P(label, PSTR("%c%u"), tag, bin);
+      display_Count(label, bins[bin]);
+    }
+}
+#endif
+
+// Answer to 10;STATS; in several messages, as they would not fit in pbuffer at once
+void display_Stats()
+{
+  display_Header();
+  display_Name(PSTR("STATS"));
+  display_Stat(PSTR("TIMEOUT"), SignalStats.Timeouts);
+  display_Stat(PSTR("NOISE"), SignalStats.Noise);
+  display_Stat(PSTR("PREAMBLE"), SignalStats.Preambles);
+  display_Stat(PSTR("SHORT"), SignalStats.Short);
+  display_Footer();
+  sendMsg();
+
+  display_Header();
+  display_Name(PSTR("STATS"));
+  display_Stat(PSTR("FULL"), SignalStats.Full);
+  display_Stat(PSTR("RUNT"), SignalStats.Runts);
+  display_Stat(PSTR("CAPTURED"), SignalStats.Captured);
+#if (defined(ESP32) || defined(ESP8266))
+  display_Stat(PSTR("DROPPED"), Capture_Dropped);
+#endif
+  display_Stat(PSTR("CUT"), Msg.Overflows);
+  display_Footer();
+  sendMsg();
+
+  display_Header();
+  display_Name(PSTR("STATS"));
+#if (defined(ESP32) || defined(ESP8266))
+  display_Stat(PSTR("OVERRUN"), EdgeRing.Overruns);
+#endif
+  display_Stat(PSTR("REPAIRED"), SignalStats.Repairs);
+  display_Stat(PSTR("SKIPPED"), SignalStats.Skipped);
+#if (defined(ESP32) || defined(ESP8266))
+  display_Stat(PSTR("QUIET"), SignalStats.Quiet);
+#endif
+  display_Stat(PSTR("DECODED"), SignalStats.Decoded);
+  display_Footer();
+  sendMsg();
+
+  // Outbound queue: messages queued, and lost by each output built in as it lagged a whole ring behind
+  display_Header();
+  display_Name(PSTR("STATS;QUEUE"));
+  display_Stat(PSTR("QUEUED"), Queue.Head);
+#ifdef SERIAL_ENABLED
+  display_Stat(PSTR("SERIAL_DROP"), Queue.Dropped[QUEUE_SERIAL]);
+#endif
+#ifdef MQTT_ENABLED
+  display_Stat(PSTR("MQTT_DROP"), Queue.Dropped[QUEUE_MQTT]);
+#endif
+#ifdef AUTOCONNECT_ENABLED
+  display_Stat(PSTR("WEB_DROP"), Queue.Dropped[QUEUE_WEB]);
+#endif
+#ifdef OLED_ENABLED
+  display_Stat(PSTR("OLED_DROP"), Queue.Dropped[QUEUE_OLED]);
+#endif
+  display_Footer();
+#ifdef STATS_HISTOGRAMS
+  sendMsg();
+
+  // Pulse lengths, P9=n: n pulses of 512..1023 uSec
+  display_Header();
+  display_Name(PSTR("STATS;PULSES"));
+  display_Histogram('P', SignalStats.PulseLog2);
+  display_Footer();
+  sendMsg();
+
+  // Packet lengths, L6=n: n packets of 64..127 pulses. Last message is sent by the caller.
+  display_Header();
+  display_Name(PSTR("STATS;LENGTHS"));
+  display_Histogram('L', SignalStats.LengthLog2);
+  display_Footer();
+#endif
+}
+
+#ifdef TASK_STATS
+// Answer to 10;TASKS; one message per loop() task, times in uSec
+void display_Tasks()
+{
+  for (byte i = 0; i < Task_Count; i++)
+  {
+    TaskStruct *task = &Tasks[i];
+
+    if (i)
+      sendMsg(); // Last message is sent by the caller
+    display_Header();
+    display_Name(PSTR("TASKS"));
+    display_Name(task->Name);
+    display_Stat(PSTR("RUNS"), task->Runs);
+    display_Stat(PSTR("BUSY"), task->Busy);
+    display_Stat(PSTR("AVG"), task->Runs ? task->Total_us / task->Runs : 0);
+    display_Stat(PSTR("MAX"), task->Max_us);
+    display_Stat(PSTR("OVER"), task->Overruns);
+    display_Footer();
+  }
+}
+#endif
+
+// <plugin>=ON|OFF of 10;PLUGINS;
+static boolean display_PluginState(byte x)
+{
+  size_t start = Msg.Length;
+
+  return Msg.Commit(start, Msg.PutChar(';') && Msg.PutNumber(Plugin_Id(x), 10, 3) && Msg.PutChar('=') &&
+                               Msg.Put_P(Plugin_IsEnabled(x) ? PSTR("ON") : PSTR("OFF")));
+}
+
+// Answer to 10;PLUGINS; every plugin built in as <plugin>=ON|OFF, in as many messages as needed
+void display_Plugins()
+{
+  display_Header();
+  display_Name(PSTR("PLUGINS"));
+  for (byte x = 0; x < Plugin_Count; x++)
+    if (!display_PluginState(x))
+    { // Full, carry on in a new message. Last message is sent by the caller
+      display_Footer();
+      sendMsg();
+      display_Header();
+      display_Name(PSTR("PLUGINS"));
+      display_PluginState(x);
+    }
+  display_Footer();
+}
+
+#if (defined(ESP32) || defined(ESP8266))
+// Same plugins tried in the same order on packets of both lengths
+static boolean display_SameOrder(int a, int b)
+{
+  for (byte i = 0;; i++)
+  {
+    byte x = PluginRXOrder(a, i);
+
+    if (x != PluginRXOrder(b, i))
+      return false;
+    if (x == Plugin_Count)
+      return true;
+  }
+}
+
+// Answer to 10;PLUGINORDER; the plugins PluginRXCall() tries, in order, as <plugin>=<hits>:
+// one message per run of packet lengths they are the same for, as PULSES=<first>-<last>.
+// Pre-pass (001) and fallback (254) plugins included, pinned pairs and plugins with no hits
+// in their place. Lengths no plugin is indexed for, which only get those, are left out.
+void display_Order()
+{
+  char label[12];
+  boolean first = true;
+
+  for (int n = 0; n <= RAW_BUFFER_SIZE; n++)
+  {
+    int last = n;
+
+    if (display_SameOrder(n, -1))
+      continue;
+    while ((last < RAW_BUFFER_SIZE) && display_SameOrder(n, last + 1))
+      last++;
+    if (last == n)
+      sprintf_P(label, PSTR("%d"), n);
+    else
+      sprintf_P(label, PSTR("%d-%d"), n, last);
+
+    if (!first)
+      sendMsg(); // Last message is sent by the caller
+    first = false;
+    display_Header();
+    display_Name(PSTR("PLUGINORDER"));
+    Msg.Text(PSTR("PULSES"), label);
+    for (byte i = 0, x; (x = PluginRXOrder(n, i)) != Plugin_Count; i++)
+    {
+      char id[4];
+
+      sprintf_P(id, PSTR("%03u"), Plugin_Id(x));
+      if (!display_Count(id, Plugin_Hits[x]))
+      { // Full, carry on in a new message
+        display_Footer();
+        sendMsg();
+        display_Header();
+        display_Name(PSTR("PLUGINORDER"));
+        Msg.Text(PSTR("PULSES"), label);
+        display_Count(id, Plugin_Hits[x]);
+      }
+    }
+    display_Footer();
+    n = last;
+  }
+  if (first)
+  { // No plugin with a length
+    display_Header();
+    display_Name(PSTR("PLUGINORDER"));
+    display_Footer();
+  }
+}
+
+// Answer to 10;PLUGINSTATS; two messages per plugin called or rejected so far: outcomes, then
+// packets rejected on their shape and CPU cycles per call
+void display_PluginStats()
+{
+  char id[4];
+  boolean first = true;
+
+  for (byte x = 0; x < Plugin_Count; x++)
+  {
+    PluginStatsStruct *stats = &Plugin_Stats[x];
+
+    if (!stats->Calls && !stats->Rejected)
+      continue;
+    if (!first)
+      sendMsg(); // Last message is sent by the caller
+    first = false;
+    sprintf_P(id, PSTR("%03u"), Plugin_Id(x));
+
+    display_Header();
+    display_Name(PSTR("PLUGINSTATS"));
+    Msg.Name(id);
+    display_Stat(PSTR("CALLS"), stats->Calls);
+    display_Stat(PSTR("OK"), stats->Decoded);
+    display_Stat(PSTR("REPEAT"), stats->Repeats);
+    display_Stat(PSTR("FAST"), stats->Fast);
+    display_Stat(PSTR("SLOW"), stats->Slow);
+    display_Footer();
+    sendMsg();
+
+    display_Header();
+    display_Name(PSTR("PLUGINSTATS"));
+    Msg.Name(id);
+    display_Stat(PSTR("REJECT"), stats->Rejected);
+    if (stats->Calls)
+    {
+      display_Stat(PSTR("MIN"), stats->Min_cycles);
+      display_Stat(PSTR("AVG"), (unsigned long)(stats->Total_cycles / stats->Calls));
+      display_Stat(PSTR("MAX"), stats->Max_cycles);
+    }
+    display_Footer();
+  }
+  if (first)
+  {
+    display_Header();
+    display_Name(PSTR("PLUGINSTATS"));
+    display_Footer();
+  }
+}
+#endif
+
+/*********************************************************************************************/
@@ -15,6 +15,7 @@
 #define FOCUS_TIME_MS 50      // 50         // Duration in mSec. that, after receiving serial data from USB only the serial port is checked.
 
 extern char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+extern boolean SerialBinary; // Decoded events go to the serial port as binary frames, see 4_Event.h
 
 boolean CheckSerial();
 boolean CheckMQTT(byte *);
@@ -9,45 +9,74 @@
 #include "RFLink.h"
 #include "3_Serial.h"
 #include "4_Display.h"
+#include "4_Event.h"
 
 byte PKSequenceNumber = 0;       // 1 byte packet counter
-char dbuffer[30];                // Buffer for message chunk data
 char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
+MessageBuilder Msg = {pbuffer, PRINT_BUFFER_SIZE, 0, 0};
 
 // ------------------- //
 // Display shared func //
 // ------------------- //
 
-#if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
-#error "For AVR plaforms, in all sprintf_P above, please replace %s with %S"
-#endif
+// Field of the decoded event being recorded, or written right away outside receive plugins
+static void display_Field(byte field, unsigned long value, byte digits = 0)
+{
+  if (Event.State == EVENT_OPEN)
+    Event_Add(field, value, digits);
+  else
+    Event_RenderEntry(&Msg, field, value, digits, NULL);
+}
+
+// text in RAM
+static void display_Text(byte field, const char *text)
+{
+  if (Event.State == EVENT_OPEN)
+    Event_AddText(field, text);
+  else
+    Event_RenderEntry(&Msg, field, 0, 0, text);
+}
 
 // Common Header
 void display_Header(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%02X"), PSTR("20;"), PKSequenceNumber++);
-  strcat(pbuffer, dbuffer);
+  size_t start = Msg.Length;
+  byte number = PKSequenceNumber++;
+
+  if (Event_Source)
+  {
+    if (Event.State != EVENT_FREE)
+      sendMsg(); // Event of the same packet before this one
+    Event_Begin(Event_Source, number);
+    return;
+  }
+  Msg.Commit(start, Msg.Put_P(PSTR("20;")) && Msg.PutNumber(number, 16, 2, true));
 }
 
 // Plugin Name
 void display_Name(const char *input)
 {
-  sprintf_P(dbuffer, PSTR(";%s"), input);
-  strcat(pbuffer, dbuffer);
+  if (Event.State == EVENT_OPEN)
+    Event_AddText_P(EVENT_NAME, input);
+  else
+    Msg.Name_P(input);
 }
 
 // Common Footer
 void display_Footer(void)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";\r\n"));
-  strcat(pbuffer, dbuffer);
+  if (Event.State == EVENT_OPEN)
+    Event.State = EVENT_READY;
+  else
+    Msg.Footer();
 }
 
 // Start message
 void display_Splash(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%d.%d"), PSTR(";RFLink_ESP;VER="), BUILDNR, REVNR);
-  strcat(pbuffer, dbuffer);
+  size_t start = Msg.Length;
+
+  Msg.Commit(start, Msg.Put_P(PSTR(";RFLink_ESP;VER=")) && Msg.PutNumber(BUILDNR, 10, 1) && Msg.PutChar('.') && Msg.PutNumber(REVNR, 10, 1));
 }
 
 // ID=9999 => device ID (often a rolling code and/or device channel number) (Hexadecimal)
@@ -56,289 +85,211 @@ void display_IDn(unsigned long input, byte n)
   switch (n)
   {
   case 2:
-    sprintf_P(dbuffer, PSTR("%s%02lx"), PSTR(";ID="), input);
-    break;
   case 4:
-    sprintf_P(dbuffer, PSTR("%s%04lx"), PSTR(";ID="), input);
-    break;
   case 6:
-    sprintf_P(dbuffer, PSTR("%s%06lx"), PSTR(";ID="), input);
+    display_Field(EVENT_ID, input, n);
     break;
   case 8:
   default:
-    sprintf_P(dbuffer, PSTR("%s%08lx"), PSTR(";ID="), input);
+    display_Field(EVENT_ID, input, 8);
   }
-  strcat(pbuffer, dbuffer);
 }
 
 void display_IDc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";ID="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  display_Text(EVENT_ID_TEXT, input);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCH(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";SWITCH="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_SWITCH, input);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCHc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";SWITCH="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  display_Text(EVENT_SWITCH_TEXT, input);
 }
 
 // CMD=ON => Command (ON/OFF/ALLON/ALLOFF) Additional for Milight: DISCO+/DISCO-/MODE0 - MODE8
 void display_CMD(boolean all, byte on)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";CMD="));
-  strcat(pbuffer, dbuffer);
-
-  if (all == CMD_All)
-  {
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ALL"));
-    strcat(pbuffer, dbuffer);
-  }
-
-  switch (on)
-  {
-  case CMD_On:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ON"));
-    break;
-  case CMD_Off:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("OFF"));
-    break;
-  case CMD_Bright:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("BRIGHT"));
-    break;
-  case CMD_Dim:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("DIM"));
-    break;
-  case CMD_Unknown:
-  default:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("UNKNOWN"));
-  }
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_CMD, ((all == CMD_All) ? EVENT_CMD_ALL : 0) | on);
 }
 
 // SET_LEVEL=15 => Direct dimming level setting value (decimal value: 0-15)
 void display_SET_LEVEL(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";SET_LEVEL="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_SET_LEVEL, input);
 }
 
 // TEMP=9999 => Temperature celcius (hexadecimal), high bit contains negative sign, needs division by 10
 void display_TEMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";TEMP="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_TEMP, input);
 }
 
 // HUM=99 => Humidity (decimal value: 0-100 to indicate relative humidity in %)
 void display_HUM(byte input, boolean bcd)
 {
-  if (bcd == HUM_BCD)
-    sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HUM="), input);
-  else
-    sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";HUM="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field((bcd == HUM_BCD) ? EVENT_HUM_BCD : EVENT_HUM, input);
 }
 
 // BARO=9999 => Barometric pressure (hexadecimal)
 void display_BARO(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";BARO="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_BARO, input);
 }
 
 // HSTATUS=99 => 0=Normal, 1=Comfortable, 2=Dry, 3=Wet
 void display_HSTATUS(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HSTATUS="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_HSTATUS, input);
 }
 
 // BFORECAST=99 => 0=No Info/Unknown, 1=Sunny, 2=Partly Cloudy, 3=Cloudy, 4=Rain
 void display_BFORECAST(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";BFORECAST="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_BFORECAST, input);
 }
 
 // UV=9999 => UV intensity (hexadecimal)
 void display_UV(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";UV="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_UV, input);
 }
 
 // LUX=9999 => Light intensity (hexadecimal)
 void display_LUX(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";LUX="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_LUX, input);
 }
 
 // BAT=OK => Battery status indicator (OK/LOW)
 void display_BAT(boolean input)
 {
-  if (input == true)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=OK"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=LOW"));
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_BAT, input == true);
 }
 
 // RAIN=1234 => Total rain in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAIN(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAIN="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_RAIN, input);
 }
 
 // RAINRATE=1234 => Rain rate in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAINRATE(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAINRATE="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_RAINRATE, input);
 }
 
 // WINSP=9999 => Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_WINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINSP="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WINSP, input);
 }
 
 // AWINSP=9999 => Average Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_AWINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";AWINSP="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_AWINSP, input);
 }
 
 // WINGS=9999 => Wind Gust in km. p/h (hexadecimal)
 void display_WINGS(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINGS="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WINGS, input);
 }
 
 // WINDIR=123 => Wind direction (integer value from 0-15) reflecting 0-360 degrees in 22.5 degree steps
 void display_WINDIR(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";WINDIR="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WINDIR, input);
 }
 
 // WINCHL => wind chill (hexadecimal, see TEMP)
 void display_WINCHL(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINCHL="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WINCHL, input);
 }
 
 // WINTMP=1234 => Wind meter temperature reading (hexadecimal, see TEMP)
 void display_WINTMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINTMP="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WINTMP, input);
 }
 
 // CHIME=123 => Chime/Doorbell melody number
 void display_CHIME(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";CHIME="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_CHIME, input);
 }
 
 // SMOKEALERT=ON => ON/OFF
 void display_SMOKEALERT(boolean input)
 {
-  if (input == SMOKE_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=OFF"));
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_SMOKEALERT, input == SMOKE_On);
 }
 
 // PIR=ON => ON/OFF
 void display_PIR(boolean input)
 {
-  if (input == PIR_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=OFF"));
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_PIR, input == PIR_On);
 }
 
 // CO2=1234 => CO2 air quality
 void display_CO2(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CO2="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_CO2, input);
 }
 
 // SOUND=1234 => Noise level
 void display_SOUND(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";SOUND="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_SOUND, input);
 }
 
 // KWATT=9999 => KWatt (hexadecimal)
 void display_KWATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";KWATT="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_KWATT, input);
 }
 
 // WATT=9999 => Watt (hexadecimal)
 void display_WATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WATT="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_WATT, input);
 }
 
 // CURRENT=1234 => Current phase 1
 void display_CURRENT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CURRENT="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_CURRENT, input);
 }
 
 // DIST=1234 => Distance
 void display_DIST(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";DIST="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_DIST, input);
 }
 
 // METER=1234 => Meter values (water/electricity etc.)
 void display_METER(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";METER="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_METER, input);
 }
 
 // VOLT=1234 => Voltage
 void display_VOLT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";VOLT="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_VOLT, input);
 }
 
 // RGBW=9999 => Milight: provides 1 byte color and 1 byte brightness value
 void display_RGBW(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RGBW="), input);
-  strcat(pbuffer, dbuffer);
+  display_Field(EVENT_RGBW, input);
 }
 
 // --------------------- //
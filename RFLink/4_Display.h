@@ -9,14 +9,17 @@
 #define Misc_h
 
 #include <Arduino.h>
+#include "4_Message.h"
 
 #define PRINT_BUFFER_SIZE 90 // 90         // Maximum number of characters that a command should print in one go via the print buffer.
 
 // extern byte PKSequenceNumber;     // 1 byte packet counter
 extern char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for printing data
 
+extern MessageBuilder Msg; // Writes pbuffer
+
 void display_Header(void);
-void display_Name(const char *);
+void display_Name(const char *); // PSTR()
 void display_Footer(void);
 void display_Splash(void);
 void display_IDn(unsigned long, byte);
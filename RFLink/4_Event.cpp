@@ -0,0 +1,468 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "4_Display.h"
+#include "4_Event.h"
+#include "7_Utils.h"
+
+#if (EVENT_FRAME_NAMES > 16)
+#error "EVENT_FRAME_NAMES must be 16 at most"
+#endif
+static_assert(EVENT_FIELDS <= EVENT_FRAME_NAME_DEF, "Fields and name types of frames overlap");
+
+EventStruct Event;
+byte Event_Source = 0;
+
+// How each field is written in a 20;XX;... message
+enum EventFormat
+{
+  EVENT_AS_NAME,  // ;text
+  EVENT_AS_HEX,   // ;LABEL=value in hex
+  EVENT_AS_DEC,   // ;LABEL=value in decimal
+  EVENT_AS_TEXT,  // ;LABEL=text
+  EVENT_AS_CMD,   // ;CMD=[ALL]ON...
+  EVENT_AS_OKLOW, // ;LABEL=OK or LOW
+  EVENT_AS_ONOFF  // ;LABEL=ON or OFF
+};
+
+struct EventFieldFormat
+{
+  char Label[11];
+  byte Format;
+  byte Digits; // 0: those of the entry
+};
+
+static const EventFieldFormat Event_Formats[EVENT_FIELDS] PROGMEM = {
+    {"", EVENT_AS_NAME, 0},            // EVENT_NAME
+    {"ID", EVENT_AS_HEX, 0},           // EVENT_ID
+    {"ID", EVENT_AS_TEXT, 0},          // EVENT_ID_TEXT
+    {"SWITCH", EVENT_AS_HEX, 2},       // EVENT_SWITCH
+    {"SWITCH", EVENT_AS_TEXT, 0},      // EVENT_SWITCH_TEXT
+    {"CMD", EVENT_AS_CMD, 0},          // EVENT_CMD
+    {"SET_LEVEL", EVENT_AS_DEC, 2},    // EVENT_SET_LEVEL
+    {"TEMP", EVENT_AS_HEX, 4},         // EVENT_TEMP
+    {"HUM", EVENT_AS_DEC, 2},          // EVENT_HUM
+    {"HUM", EVENT_AS_HEX, 2},          // EVENT_HUM_BCD
+    {"BARO", EVENT_AS_HEX, 4},         // EVENT_BARO
+    {"HSTATUS", EVENT_AS_HEX, 2},      // EVENT_HSTATUS
+    {"BFORECAST", EVENT_AS_HEX, 2},    // EVENT_BFORECAST
+    {"UV", EVENT_AS_HEX, 4},           // EVENT_UV
+    {"LUX", EVENT_AS_HEX, 4},          // EVENT_LUX
+    {"BAT", EVENT_AS_OKLOW, 0},        // EVENT_BAT
+    {"RAIN", EVENT_AS_HEX, 4},         // EVENT_RAIN
+    {"RAINRATE", EVENT_AS_HEX, 4},     // EVENT_RAINRATE
+    {"WINSP", EVENT_AS_HEX, 4},        // EVENT_WINSP
+    {"AWINSP", EVENT_AS_HEX, 4},       // EVENT_AWINSP
+    {"WINGS", EVENT_AS_HEX, 4},        // EVENT_WINGS
+    {"WINDIR", EVENT_AS_DEC, 3},       // EVENT_WINDIR
+    {"WINCHL", EVENT_AS_HEX, 4},       // EVENT_WINCHL
+    {"WINTMP", EVENT_AS_HEX, 4},       // EVENT_WINTMP
+    {"CHIME", EVENT_AS_DEC, 3},        // EVENT_CHIME
+    {"SMOKEALERT", EVENT_AS_ONOFF, 0}, // EVENT_SMOKEALERT
+    {"PIR", EVENT_AS_ONOFF, 0},        // EVENT_PIR
+    {"CO2", EVENT_AS_DEC, 4},          // EVENT_CO2
+    {"SOUND", EVENT_AS_DEC, 4},        // EVENT_SOUND
+    {"KWATT", EVENT_AS_HEX, 4},        // EVENT_KWATT
+    {"WATT", EVENT_AS_HEX, 4},         // EVENT_WATT
+    {"CURRENT", EVENT_AS_DEC, 4},      // EVENT_CURRENT
+    {"DIST", EVENT_AS_DEC, 4},         // EVENT_DIST
+    {"METER", EVENT_AS_DEC, 4},        // EVENT_METER
+    {"VOLT", EVENT_AS_DEC, 4},         // EVENT_VOLT
+    {"RGBW", EVENT_AS_HEX, 4},         // EVENT_RGBW
+};
+
+// ----------------- //
+// Event record      //
+// ----------------- //
+
+void Event_Begin(byte plugin, byte number)
+{
+  Event.State = EVENT_OPEN;
+  Event.Number = number;
+  Event.Plugin = plugin;
+  Event.Count = 0;
+  Event.TextLength = 0;
+}
+
+boolean Event_Add(byte field, unsigned long value, byte digits)
+{
+  EventEntry *entry;
+
+  if (Event.Count >= EVENT_ENTRIES)
+  {
+    Msg.Overflows++;
+    return false;
+  }
+  entry = &Event.Entries[Event.Count++];
+  entry->Field = field;
+  entry->Digits = digits;
+  entry->Value = value;
+  return true;
+}
+
+// Room for a text of length characters, terminating 0 included: where to copy it, NULL if none
+static char *Event_TextRoom(byte field, size_t length)
+{
+  char *room = Event.Text + Event.TextLength;
+
+  if (Event.TextLength + length > EVENT_TEXT_SIZE)
+  {
+    Msg.Overflows++;
+    return NULL;
+  }
+  if (!Event_Add(field, Event.TextLength))
+    return NULL;
+  Event.TextLength += length;
+  return room;
+}
+
+boolean Event_AddText(byte field, const char *text)
+{
+  size_t length = strlen(text) + 1;
+  char *room = Event_TextRoom(field, length);
+
+  if (room)
+    memcpy(room, text, length);
+  return room != NULL;
+}
+
+boolean Event_AddText_P(byte field, const char *text)
+{
+  size_t length = strlen_P(text) + 1;
+  char *room = Event_TextRoom(field, length);
+
+  if (room)
+    memcpy_P(room, text, length);
+  return room != NULL;
+}
+
+const EventEntry *Event_Find(const EventStruct *event, byte field)
+{
+  for (byte i = 0; i < event->Count; i++)
+    if (event->Entries[i].Field == field)
+      return &event->Entries[i];
+  return NULL;
+}
+
+// ----------------- //
+// Text rendering    //
+// ----------------- //
+
+static const char *Event_Command(byte on)
+{
+  switch (on)
+  {
+  case CMD_On:
+    return PSTR("ON");
+  case CMD_Off:
+    return PSTR("OFF");
+  case CMD_Bright:
+    return PSTR("BRIGHT");
+  case CMD_Dim:
+    return PSTR("DIM");
+  case CMD_Unknown:
+  default:
+    return PSTR("UNKNOWN");
+  }
+}
+
+boolean Event_RenderEntry(MessageBuilder *msg, byte field, unsigned long value, byte digits, const char *text)
+{
+  const EventFieldFormat *format = &Event_Formats[field];
+  const char *label = format->Label;
+  size_t start = msg->Length;
+
+  if (pgm_read_byte(&format->Digits))
+    digits = pgm_read_byte(&format->Digits);
+
+  switch (pgm_read_byte(&format->Format))
+  {
+  case EVENT_AS_NAME:
+    return msg->Name(text);
+  case EVENT_AS_HEX:
+    return msg->Hex(label, value, digits);
+  case EVENT_AS_DEC:
+    return msg->Dec(label, value, digits);
+  case EVENT_AS_TEXT:
+    return msg->Text(label, text);
+  case EVENT_AS_CMD:
+    return msg->Commit(start, msg->Put_P(PSTR(";CMD=")) && (!(value & EVENT_CMD_ALL) || msg->Put_P(PSTR("ALL"))) &&
+                                  msg->Put_P(Event_Command(value & ~EVENT_CMD_ALL)));
+  case EVENT_AS_OKLOW:
+    return msg->Text_P(label, value ? PSTR("OK") : PSTR("LOW"));
+  case EVENT_AS_ONOFF:
+  default:
+    return msg->Text_P(label, value ? PSTR("ON") : PSTR("OFF"));
+  }
+}
+
+void Event_Render(MessageBuilder *msg, const EventStruct *event)
+{
+  size_t start = msg->Length;
+
+  msg->Commit(start, msg->Put_P(PSTR("20;")) && msg->PutNumber(event->Number, 16, 2, true));
+  for (byte i = 0; i < event->Count; i++)
+  {
+    const EventEntry *entry = &event->Entries[i];
+    boolean text = (entry->Field == EVENT_NAME) || (entry->Field == EVENT_ID_TEXT) || (entry->Field == EVENT_SWITCH_TEXT);
+
+    Event_RenderEntry(msg, entry->Field, entry->Value, entry->Digits, text ? Event_Text(event, entry) : NULL);
+  }
+  if (event->State == EVENT_READY)
+    msg->Footer();
+}
+
+// ----------------- //
+// Binary frame      //
+// ----------------- //
+
+static uint32_t Event_FrameNames[EVENT_FRAME_NAMES]; // Hash of the names sent, 0 for none
+static byte Event_FrameRefs[EVENT_FRAME_NAMES];      // Frames that gave each name by its index since it was defined
+static byte Event_FrameNext = 0;                     // Index the next new name replaces
+
+void Event_FrameReset()
+{
+  memset(Event_FrameNames, 0, sizeof(Event_FrameNames));
+  memset(Event_FrameRefs, 0, sizeof(Event_FrameRefs));
+  Event_FrameNext = 0;
+}
+
+// FNV-1a, never 0
+static uint32_t Event_FrameHash(const char *text)
+{
+  uint32_t hash = 2166136261UL;
+
+  while (*text)
+    hash = (hash ^ (byte)*text++) * 16777619UL;
+  return hash ? hash : 1;
+}
+
+static byte Event_FrameSize(unsigned long value)
+{
+  byte size = 1;
+
+  while ((size < 4) && (value >> (8 * size)))
+    size++;
+  return size;
+}
+
+size_t Event_Frame(byte *frame, const EventStruct *event)
+{
+  size_t length = 4;
+  uint16_t crc;
+
+  frame[0] = EVENT_FRAME_SYNC;
+  frame[2] = event->Number;
+  frame[3] = event->Plugin;
+  for (byte i = 0; i < event->Count; i++)
+  {
+    const EventEntry *entry = &event->Entries[i];
+
+    if ((entry->Field == EVENT_ID_TEXT) || (entry->Field == EVENT_SWITCH_TEXT))
+    {
+      const char *text = Event_Text(event, entry);
+      byte size = strlen(text);
+
+      frame[length++] = entry->Field;
+      frame[length++] = size;
+      memcpy(frame + length, text, size);
+      length += size;
+    }
+    else if (entry->Field == EVENT_NAME)
+    {
+      const char *text = Event_Text(event, entry);
+      uint32_t hash = Event_FrameHash(text);
+      byte index = 0;
+
+      while ((index < EVENT_FRAME_NAMES) && (Event_FrameNames[index] != hash))
+        index++;
+      if ((index < EVENT_FRAME_NAMES) && (Event_FrameRefs[index] < EVENT_FRAME_REDEFINE))
+      {
+        Event_FrameRefs[index]++;
+        frame[length++] = EVENT_FRAME_NAME_REF + index;
+      }
+      else
+      { // New name, or defined again at its index for the hosts that missed it
+        byte size = strlen(text);
+
+        if (index == EVENT_FRAME_NAMES)
+        {
+          index = Event_FrameNext;
+          Event_FrameNext = (Event_FrameNext + 1) % EVENT_FRAME_NAMES;
+          Event_FrameNames[index] = hash;
+        }
+        Event_FrameRefs[index] = 0;
+        frame[length++] = EVENT_FRAME_NAME_DEF;
+        frame[length++] = size + 1;
+        frame[length++] = index;
+        memcpy(frame + length, text, size);
+        length += size;
+      }
+    }
+    else if ((entry->Field == EVENT_ID) && (Event_FrameSize(entry->Value) > entry->Digits / 2))
+    { // Wider than its digits: as the text has it
+      byte size = 0;
+
+      for (unsigned long value = entry->Value; value; value >>= 4)
+        size++;
+      frame[length++] = EVENT_ID_TEXT;
+      frame[length++] = size;
+      while (size--)
+        frame[length++] = "0123456789abcdef"[(entry->Value >> (4 * size)) & 0x0F];
+    }
+    else
+    {
+      byte size = (entry->Field == EVENT_ID) ? entry->Digits / 2 : Event_FrameSize(entry->Value);
+
+      frame[length++] = ((size - 1) << 6) | entry->Field;
+      while (size)
+        frame[length++] = entry->Value >> (8 * --size);
+    }
+  }
+  frame[1] = length - 2;
+  crc = crc16(frame + 1, length - 1, 0x1021, 0xFFFF);
+  frame[length++] = crc >> 8;
+  frame[length++] = crc & 0xFF;
+  return length;
+}
+
+// ----------------- //
+// JSON              //
+// ----------------- //
+
+// text from event->Text, as in a JSON string, or as a topic level
+static boolean Event_PutText(MessageBuilder *msg, const char *text, boolean topic)
+{
+  for (; *text; text++)
+  {
+    char c = *text;
+
+    if (topic && ((c == ' ') || (c == '/') || (c == '+') || (c == '#')))
+      c = '_';
+    else if ((byte)c < ' ')
+      continue;
+    else if (!topic && ((c == '"') || (c == '\\')) && !msg->PutChar('\\'))
+      return false;
+    if (!msg->PutChar(c))
+      return false;
+  }
+  return true;
+}
+
+// value in tenths, as 12.3
+static boolean Event_PutTenths(MessageBuilder *msg, unsigned long value)
+{
+  return msg->PutNumber(value / 10, 10, 1) && msg->PutChar('.') && msg->PutNumber(value % 10, 10, 1);
+}
+
+static boolean Event_JsonValue(MessageBuilder *msg, const EventStruct *event, const EventEntry *entry)
+{
+  unsigned long value = entry->Value;
+
+  switch (entry->Field)
+  {
+  case EVENT_NAME:
+  case EVENT_ID_TEXT:
+  case EVENT_SWITCH_TEXT:
+    return msg->PutChar('"') && Event_PutText(msg, Event_Text(event, entry), false) && msg->PutChar('"');
+  case EVENT_ID:
+    return msg->PutChar('"') && msg->PutNumber(value, 16, entry->Digits) && msg->PutChar('"');
+  case EVENT_SWITCH:
+    return msg->PutChar('"') && msg->PutNumber(value, 16, 2) && msg->PutChar('"');
+  case EVENT_CMD:
+    return msg->PutChar('"') && (!(value & EVENT_CMD_ALL) || msg->Put_P(PSTR("ALL"))) &&
+           msg->Put_P(Event_Command(value & ~EVENT_CMD_ALL)) && msg->PutChar('"');
+  case EVENT_BAT:
+    return msg->Put_P(value ? PSTR("\"OK\"") : PSTR("\"LOW\""));
+  case EVENT_SMOKEALERT:
+  case EVENT_PIR:
+    return msg->Put_P(value ? PSTR("\"ON\"") : PSTR("\"OFF\""));
+  case EVENT_TEMP:
+  case EVENT_WINCHL:
+  case EVENT_WINTMP: // High bit for negative values
+    return (!(value & 0x8000) || msg->PutChar('-')) && Event_PutTenths(msg, value & 0x7FFF);
+  case EVENT_RAIN:
+  case EVENT_RAINRATE:
+  case EVENT_WINSP:
+  case EVENT_AWINSP:
+    return Event_PutTenths(msg, value);
+  case EVENT_HUM_BCD:
+    return msg->PutNumber((value >> 4) * 10 + (value & 0x0F), 10, 1);
+  default:
+    return msg->PutNumber(value, 10, 1);
+  }
+}
+
+boolean Event_Json(MessageBuilder *msg, const EventStruct *event)
+{
+  boolean fits = true;
+  boolean first = true;
+  byte names = 0;
+  size_t start;
+
+  if (!msg->PutChar('{'))
+    return false;
+  for (byte i = 0; i < event->Count; i++)
+  {
+    const EventEntry *entry = &event->Entries[i];
+
+    if ((entry->Field == EVENT_NAME) && names++)
+      continue; // In INFO
+    start = msg->Length;
+    if (msg->Commit(start, (first || msg->PutChar(',')) && msg->PutChar('"') &&
+                               msg->Put_P((entry->Field == EVENT_NAME) ? PSTR("PROTOCOL") : Event_Formats[entry->Field].Label) &&
+                               msg->Put_P(PSTR("\":")) && Event_JsonValue(msg, event, entry)))
+      first = false;
+    else
+      fits = false;
+  }
+  if (names > 1)
+  {
+    boolean put;
+
+    start = msg->Length;
+    put = (first || msg->PutChar(',')) && msg->Put_P(PSTR("\"INFO\":\""));
+    names = 0;
+    for (byte i = 0; put && (i < event->Count); i++)
+      if ((event->Entries[i].Field == EVENT_NAME) && names++)
+        put = msg->PutChar(';') && Event_PutText(msg, Event_Text(event, &event->Entries[i]), false);
+    if (!msg->Commit(start, put && msg->PutChar('"')))
+      fits = false;
+  }
+  msg->Buffer[msg->Length++] = '}'; // Room kept for a footer
+  msg->Buffer[msg->Length] = 0;
+  return fits;
+}
+
+boolean Event_Topic(MessageBuilder *msg, const EventStruct *event)
+{
+  const EventEntry *name = Event_Find(event, EVENT_NAME);
+  const EventEntry *id = NULL;
+  const EventEntry *button = NULL;
+  size_t start = msg->Length;
+  boolean put;
+
+  for (byte i = 0; i < event->Count; i++)
+  {
+    const EventEntry *entry = &event->Entries[i];
+
+    if (!id && ((entry->Field == EVENT_ID) || (entry->Field == EVENT_ID_TEXT)))
+      id = entry;
+    if (!button && ((entry->Field == EVENT_SWITCH) || (entry->Field == EVENT_SWITCH_TEXT)))
+      button = entry;
+  }
+
+  put = msg->PutChar('/') && (name ? Event_PutText(msg, Event_Text(event, name), true) : msg->PutNumber(event->Plugin, 10, 3));
+  if (put && id)
+  {
+    put = msg->PutChar('/') && ((id->Field == EVENT_ID) ? msg->PutNumber(id->Value, 16, id->Digits) : Event_PutText(msg, Event_Text(event, id), true));
+    if (put && button)
+      put = msg->PutChar('/') && ((button->Field == EVENT_SWITCH) ? msg->PutNumber(button->Value, 16, 2) : Event_PutText(msg, Event_Text(event, button), true));
+  }
+  return msg->Commit(start, put);
+}
@@ -0,0 +1,162 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Event_h
+#define Event_h
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else // host build (frame decoder)
+#include <stddef.h>
+#include <stdint.h>
+typedef uint8_t byte;
+typedef bool boolean;
+#endif
+
+#if (defined(ESP32) || defined(ESP8266))
+#define EVENT_ENTRIES 16   // 16         // Names and fields one decoded message holds
+#define EVENT_TEXT_SIZE 64 // 64         // Room for its texts (names, IDc, SWITCHc), terminating 0s included
+#else
+#define EVENT_ENTRIES 10   // 10         // As above, within the RAM of an AVR
+#define EVENT_TEXT_SIZE 32 // 32
+#endif
+
+// ***********************************************************************************
+// Decoded event
+// What the display_* functions of a receive plugin leave, as typed entries in the order
+// they were called: the plugin that decoded, then names, ID, SWITCH, CMD and values. Each
+// output renders it in its own format when it sends it, see sendMsg(): the text of the
+// 20;XX;... message is only built there. Outside receive plugins (answers to commands)
+// display_* write their text to Msg right away.
+// ***********************************************************************************
+enum EventField : byte
+{
+  EVENT_NAME,        // Value: offset in Text. Protocol name first, then any word the plugin adds
+  EVENT_ID,          // Value: device ID, Digits hex digits
+  EVENT_ID_TEXT,     // Value: offset in Text
+  EVENT_SWITCH,      // Value: switch number
+  EVENT_SWITCH_TEXT, // Value: offset in Text
+  EVENT_CMD,         // Value: CMD_OnOff, EVENT_CMD_ALL added for group commands
+  EVENT_SET_LEVEL,
+  EVENT_TEMP, // Tenths of a degree, high bit for negative values
+  EVENT_HUM,
+  EVENT_HUM_BCD,
+  EVENT_BARO,
+  EVENT_HSTATUS,
+  EVENT_BFORECAST,
+  EVENT_UV,
+  EVENT_LUX,
+  EVENT_BAT, // 1 OK, 0 LOW
+  EVENT_RAIN,
+  EVENT_RAINRATE,
+  EVENT_WINSP,
+  EVENT_AWINSP,
+  EVENT_WINGS,
+  EVENT_WINDIR,
+  EVENT_WINCHL,
+  EVENT_WINTMP,
+  EVENT_CHIME,
+  EVENT_SMOKEALERT, // 1 ON, 0 OFF
+  EVENT_PIR,        // 1 ON, 0 OFF
+  EVENT_CO2,
+  EVENT_SOUND,
+  EVENT_KWATT,
+  EVENT_WATT,
+  EVENT_CURRENT,
+  EVENT_DIST,
+  EVENT_METER,
+  EVENT_VOLT,
+  EVENT_RGBW,
+  EVENT_FIELDS
+};
+
+#define EVENT_CMD_ALL 0x80
+
+enum EventState
+{
+  EVENT_FREE,  // Nothing to send
+  EVENT_OPEN,  // Between display_Header() and display_Footer()
+  EVENT_READY  // Complete, waiting for sendMsg()
+};
+
+struct EventEntry
+{
+  byte Field;          // EventField
+  byte Digits;         // EVENT_ID only
+  unsigned long Value;
+};
+
+struct EventStruct
+{
+  byte State;      // EventState
+  byte Number;     // Sequence number, XX of 20;XX
+  byte Plugin;     // Plugin that decoded it: the protocol id
+  byte Count;      // Entries
+  byte TextLength; // Used in Text
+  EventEntry Entries[EVENT_ENTRIES];
+  char Text[EVENT_TEXT_SIZE];
+};
+
+extern EventStruct Event;
+extern byte Event_Source; // Receive plugin running, 0 outside: display_* then write text
+
+struct MessageBuilder;
+
+void Event_Begin(byte plugin, byte number);
+boolean Event_Add(byte field, unsigned long value, byte digits = 0);
+boolean Event_AddText(byte field, const char *text);                // text in RAM
+boolean Event_AddText_P(byte field, const char *text);              // text in flash (PSTR)
+const EventEntry *Event_Find(const EventStruct *event, byte field); // First entry of field, NULL if none
+inline const char *Event_Text(const EventStruct *event, const EventEntry *entry) { return event->Text + entry->Value; }
+
+// Entry as ;LABEL=value, as the display_* functions always wrote it. text in RAM
+boolean Event_RenderEntry(MessageBuilder *msg, byte field, unsigned long value, byte digits, const char *text);
+// Whole event as a 20;XX;... message appended to msg
+void Event_Render(MessageBuilder *msg, const EventStruct *event);
+
+// ***********************************************************************************
+// Binary frame
+// The same event in a few bytes, for serial hosts that select it (10;SERIAL=BINARY;):
+//   EVENT_FRAME_SYNC, length of what follows up to the CRC, sequence number, plugin id,
+//   fields, CRC16 (polynomial 0x1021, init 0xFFFF, high byte first) of length..fields
+// Fields are TLV, in event order. The type byte holds the EventField in its low 6 bits.
+// Numbers take the high 2 bits as their size - 1 and follow high byte first: the size of
+// an ID is its digits / 2, the smallest that holds the value otherwise. IDc and SWITCHc
+// follow as a length byte then the text, without terminating 0, as does an ID wider than
+// its digits.
+// Names are sent once in a while: EVENT_FRAME_NAME_DEF gives the text (length, index,
+// text) of the name that later frames only give the index of, as type byte
+// EVENT_FRAME_NAME_REF + index. A host that missed the definition, having connected later
+// or dropped that frame on a bad CRC, gets it again with the first frame of the name
+// after EVENT_FRAME_REDEFINE frames that referred to it, or at once by selecting binary
+// output again: 10;SERIAL=BINARY; empties the table. Text messages (answers to
+// commands, debug) are still sent as text between frames: they never hold the sync byte.
+// tools/event_decode.cpp turns frames back into text.
+// ***********************************************************************************
+#define EVENT_FRAME_SYNC 0xA5
+#define EVENT_FRAME_NAMES 16    // 16         // Names the index table holds, the oldest being replaced. 16 at most.
+#define EVENT_FRAME_REDEFINE 16 // 16         // Frames that give a name by its index before it is defined again. 255 at most.
+#define EVENT_FRAME_SIZE (4 + EVENT_ENTRIES * 10 + EVENT_TEXT_SIZE + 2) // An ID wider than its digits goes as text
+#define EVENT_FRAME_NAME_DEF 0x2F
+#define EVENT_FRAME_NAME_REF 0x30 // To 0x3F
+
+size_t Event_Frame(byte *frame, const EventStruct *event); // EVENT_FRAME_SIZE bytes at most
+void Event_FrameReset();                                   // Forget the names sent
+
+// ***********************************************************************************
+// JSON
+// The event as one flat object, for MQTT consumers that select it (10;MQTT=JSON;):
+//   {"PROTOCOL":"Oregon TempHygro","ID":"cc1d","TEMP":22.1,"HUM":51,"BAT":"OK"}
+// Labels are those of the text. Values are in units: tenths and the TEMP sign bit are
+// applied, BCD humidity is decimal. ID, SWITCH and CMD are strings as in the text. Names
+// a plugin adds after the first one go in INFO, as the text has them.
+// Its topic is /<protocol>/<id>[/<switch>], after a prefix, spaces / + and # made '_'.
+// ***********************************************************************************
+boolean Event_Json(MessageBuilder *msg, const EventStruct *event);  // false when a field did not fit
+boolean Event_Topic(MessageBuilder *msg, const EventStruct *event); // Appended to msg, false when it did not fit
+
+#endif
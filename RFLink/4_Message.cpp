@@ -0,0 +1,136 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <string.h>
+#include "4_Message.h"
+
+void MessageBuilder::Clear()
+{
+  Length = 0;
+  Buffer[0] = 0;
+}
+
+boolean MessageBuilder::Put(const char *text)
+{
+  size_t length = strlen(text);
+
+  if (length > Room())
+    return false;
+  memcpy(Buffer + Length, text, length);
+  Length += length;
+  return true;
+}
+
+boolean MessageBuilder::Put_P(const char *text)
+{
+  size_t length = strlen_P(text);
+
+  if (length > Room())
+    return false;
+  memcpy_P(Buffer + Length, text, length);
+  Length += length;
+  return true;
+}
+
+boolean MessageBuilder::PutChar(char c)
+{
+  if (!Room())
+    return false;
+  Buffer[Length++] = c;
+  return true;
+}
+
+// Zero padded to digits at least, as %0<digits>lx or %0<digits>lu
+boolean MessageBuilder::PutNumber(unsigned long value, byte base, byte digits, boolean upper)
+{
+  char text[sizeof(unsigned long) * 8]; // Base 2 at worst
+  const char *figures = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  byte count = 0;
+
+  do
+  {
+    if (base == 16)
+    {
+      text[count++] = figures[value & 0x0F];
+      value >>= 4;
+    }
+    else
+    {
+      text[count++] = figures[value % base];
+      value /= base;
+    }
+  } while ((value || (count < digits)) && (count < sizeof(text)));
+
+  if (count > Room())
+    return false;
+  while (count)
+    Buffer[Length++] = text[--count];
+  return true;
+}
+
+boolean MessageBuilder::Commit(size_t start, boolean fits)
+{
+  if (!fits)
+  {
+    Length = start;
+    Overflows++;
+  }
+  Buffer[Length] = 0;
+  return fits;
+}
+
+boolean MessageBuilder::Name(const char *name)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put(name));
+}
+
+boolean MessageBuilder::Name_P(const char *name)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put_P(name));
+}
+
+boolean MessageBuilder::Text(const char *label, const char *text)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put_P(label) && PutChar('=') && Put(text));
+}
+
+boolean MessageBuilder::Text_P(const char *label, const char *text)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put_P(label) && PutChar('=') && Put_P(text));
+}
+
+boolean MessageBuilder::Hex(const char *label, unsigned long value, byte digits, boolean upper)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put_P(label) && PutChar('=') && PutNumber(value, 16, digits, upper));
+}
+
+boolean MessageBuilder::Dec(const char *label, unsigned long value, byte digits)
+{
+  size_t start = Length;
+
+  return Commit(start, PutChar(';') && Put_P(label) && PutChar('=') && PutNumber(value, 10, digits));
+}
+
+void MessageBuilder::Footer()
+{
+  if (Length + MSG_FOOTER_LENGTH < Size) // Room kept by every other append
+  {
+    memcpy(Buffer + Length, ";\r\n", MSG_FOOTER_LENGTH);
+    Length += MSG_FOOTER_LENGTH;
+  }
+  Buffer[Length] = 0;
+}
@@ -0,0 +1,61 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Message_h
+#define Message_h
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else // host build (tools/message_bench.cpp)
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+typedef uint8_t byte;
+typedef bool boolean;
+#define PSTR(s) (s)
+#define strlen_P strlen
+#define memcpy_P memcpy
+#endif
+
+// ***********************************************************************************
+// Message builder
+// Messages are appended to pbuffer through Msg, which keeps the write cursor: no append has
+// to look for the end of the message, and numbers are written without going through printf.
+// Each field goes in whole or not at all, room for the footer always being kept: a message
+// too long for the buffer ends after its last complete field, and is counted in Overflows.
+// Labels are in flash (PSTR), given without ';' and '='. Texts are in RAM, or in flash for the
+// _P variants: reading a RAM pointer as flash only works on ESP.
+// ***********************************************************************************
+#define MSG_FOOTER_LENGTH 3 // ";\r\n"
+
+struct MessageBuilder
+{
+    char *Buffer;
+    size_t Size;             // Buffer size, terminating 0 included
+    size_t Length;           // Write cursor
+    unsigned long Overflows; // Fields left out since boot, CUT in 10;STATS;
+
+    void Clear();
+    boolean Name(const char *name);                                                      // ;name
+    boolean Name_P(const char *name);                                                    // ;name, name in flash
+    boolean Text(const char *label, const char *text);                                   // ;label=text
+    boolean Text_P(const char *label, const char *text);                                 // ;label=text, text in flash
+    boolean Hex(const char *label, unsigned long value, byte digits, boolean upper = false); // ;label=value in hex, digits at least
+    boolean Dec(const char *label, unsigned long value, byte digits);                    // ;label=value in decimal, digits at least
+    void Footer();                                                                       // ;\r\n, always fits
+
+    // Pieces of a field, from start: Commit() takes them all back when one did not fit
+    boolean Put(const char *text);
+    boolean Put_P(const char *text);
+    boolean PutChar(char c);
+    boolean PutNumber(unsigned long value, byte base, byte digits, boolean upper = false);
+    boolean Commit(size_t start, boolean fits);
+
+    size_t Room() const { return (Length + MSG_FOOTER_LENGTH + 1 < Size) ? Size - 1 - MSG_FOOTER_LENGTH - Length : 0; }
+};
+
+#endif
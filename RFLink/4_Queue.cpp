@@ -0,0 +1,92 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "4_Queue.h"
+
+QueueStruct Queue;
+
+// Outputs built in: the others never have anything waiting
+static const byte Queue_Outputs = 0
+#ifdef SERIAL_ENABLED
+                                  | (1 << QUEUE_SERIAL)
+#endif
+#ifdef MQTT_ENABLED
+                                  | (1 << QUEUE_MQTT)
+#endif
+#ifdef AUTOCONNECT_ENABLED
+                                  | (1 << QUEUE_WEB)
+#endif
+#ifdef OLED_ENABLED
+                                  | (1 << QUEUE_OLED)
+#endif
+    ;
+
+QueueSlot *Queue_Add()
+{
+  QueueSlot *slot;
+
+  for (byte output = 0; output < QUEUE_OUTPUTS; output++)
+    if (!(Queue_Outputs & (1 << output)))
+      Queue.Next[output] = Queue.Head + 1;
+    else if (Queue.Head - Queue.Next[output] >= QUEUE_SLOTS)
+    { // Its oldest message is in the slot about to be filled
+      Queue.Next[output]++;
+      Queue.Dropped[output]++;
+    }
+  slot = &Queue.Slots[Queue.Head++ % QUEUE_SLOTS];
+  slot->Counted = false;
+  return slot;
+}
+
+boolean Queue_Full()
+{
+  for (byte output = 0; output < QUEUE_OUTPUTS; output++)
+    if (Queue.Head - Queue.Next[output] >= QUEUE_SLOTS)
+      return true;
+  return false;
+}
+
+QueueSlot *Queue_Peek(byte output)
+{
+  if (Queue.Next[output] == Queue.Head)
+    return NULL;
+  return &Queue.Slots[Queue.Next[output] % QUEUE_SLOTS];
+}
+
+void Queue_Pop(byte output)
+{
+  if (Queue.Next[output] != Queue.Head)
+    Queue.Next[output]++;
+}
+
+size_t Queue_Text(QueueSlot *slot, MessageBuilder *msg)
+{
+  msg->Clear();
+  if (slot->Decoded)
+  {
+    unsigned long overflows = msg->Overflows;
+
+    Event_Render(msg, &slot->Event);
+    if (!slot->Counted)
+      Msg.Overflows += msg->Overflows - overflows;
+    slot->Counted = true;
+  }
+  else
+  { // As it was built in pbuffer, footer included
+    strncpy(msg->Buffer, slot->Text, msg->Size - 1);
+    msg->Buffer[msg->Size - 1] = 0;
+    msg->Length = strlen(msg->Buffer);
+  }
+  return msg->Length;
+}
+
+void Queue_ResetStats()
+{
+  memset(Queue.Dropped, 0, sizeof(Queue.Dropped));
+}
@@ -0,0 +1,74 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Queue_h
+#define Queue_h
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "4_Display.h"
+#include "4_Event.h"
+
+#if (defined(ESP32) || defined(ESP8266))
+#define QUEUE_SLOTS 8        // 8          // Messages waiting for the slowest output
+#define QUEUE_SERIAL_ROOM 64 // 64         // Free bytes in the serial transmit buffer before a message is written
+#else
+#define QUEUE_SLOTS 1        // 1          // As above, within the RAM of an AVR: serial is its only output
+#define QUEUE_SERIAL_ROOM 32 // 32
+#define QUEUE_RENDERED       //            // Events queued as their text, unless sent as binary frames
+#endif
+
+// ***********************************************************************************
+// Outbound messages
+// sendMsg() queues the text of pbuffer and the decoded event in a ring of QUEUE_SLOTS,
+// then returns: each output sends from its own cursor at its own pace (serial when its
+// transmit buffer has room, MQTT when connected, OLED one message per call), so a burst
+// of packets no longer waits for the slowest of them. An event is kept typed and
+// rendered by each output in its format as it sends it, see 4_Event.h.
+// An output a whole ring behind loses its oldest message, counted in its Dropped and
+// shown by 10;STATS; an answer to a command rather waits for room, see sendMsg().
+// With QUEUE_RENDERED (AVR) events wait for room as well, and are rendered as they are
+// queued: the serial port then writes slots as they are, without a buffer of its own.
+// ***********************************************************************************
+enum QueueOutput
+{
+  QUEUE_SERIAL,
+  QUEUE_MQTT,
+  QUEUE_WEB, // LastMsg of the AutoConnect pages
+  QUEUE_OLED,
+  QUEUE_OUTPUTS
+};
+
+struct QueueSlot
+{
+  boolean Decoded; // Event, Text otherwise
+  boolean Counted; // Fields its text left out are in CUT of 10;STATS; once, whichever output renders it first
+  union
+  {
+    EventStruct Event;
+    char Text[PRINT_BUFFER_SIZE];
+  };
+};
+
+struct QueueStruct
+{
+  unsigned long Head;                   // Messages queued since boot, the next one goes to Slots[Head % QUEUE_SLOTS]
+  unsigned long Next[QUEUE_OUTPUTS];    // Next message each output sends, Head when it has sent them all
+  unsigned long Dropped[QUEUE_OUTPUTS]; // Messages overwritten before the output sent them
+  QueueSlot Slots[QUEUE_SLOTS];
+};
+
+extern QueueStruct Queue;
+
+QueueSlot *Queue_Add();                                        // Slot to fill with the next message, made room for
+boolean Queue_Full();                                          // An output has QUEUE_SLOTS messages waiting
+QueueSlot *Queue_Peek(byte output);                            // Next message of output, NULL if none
+void Queue_Pop(byte output);                                   // Sent by output
+size_t Queue_Text(QueueSlot *slot, MessageBuilder *msg);       // Text of the message in msg, its length
+void Queue_ResetStats();
+
+#endif
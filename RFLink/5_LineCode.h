@@ -0,0 +1,240 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef LineCode_h
+#define LineCode_h
+
+#include <string.h>
+#include "2_Signal.h"
+
+// ***********************************************************************************
+// Line code decoders for the plugins
+// Timings are template parameters in uSec, turned into RAWSIGNAL_SAMPLE_RATE units at
+// compile time. Each decoder reads pulses from RawSignal->Pulses[pos] on and fills a
+// LineBits buffer, MSB first, and returns false on the first pulse that does not fit:
+// the plugin can leave without looking at the rest of the packet.
+// Pulse pairs are (odd, even) from pos = 1 or (even, odd) from pos = 2, as the plugin needs.
+// Header only, so the same code builds on the host: see tools/linecode_test.cpp.
+// ***********************************************************************************
+
+template <unsigned int Bits>
+struct LineBits
+{
+  unsigned int Count;           // Bits added
+  byte Data[(Bits + 7) / 8];    // First bit in the MSB of Data[0]
+
+  void Clear()
+  {
+    Count = 0;
+    memset(Data, 0, sizeof(Data));
+  }
+
+  boolean Add(boolean bit)
+  {
+    if (Count >= Bits)
+      return false;
+    if (bit)
+      Data[Count >> 3] |= 0x80 >> (Count & 7);
+    Count++;
+    return true;
+  }
+
+  boolean Get(unsigned int i) const
+  {
+    return (Data[i >> 3] >> (7 - (i & 7))) & 1;
+  }
+
+  // Bits first..first+count-1 as a number, count 32 at most
+  unsigned long Value(unsigned int first, byte count) const
+  {
+    unsigned long value = 0;
+
+    while (count--)
+      value = (value << 1) | Get(first++);
+    return value;
+  }
+};
+
+// Pulse in the window nominal +/- tolerance, in uSec
+template <unsigned int Nominal, unsigned int Tolerance>
+inline boolean LineCode_Fits(byte pulse)
+{
+  return (pulse >= ((Nominal > Tolerance) ? (Nominal - Tolerance) : 0) / RAWSIGNAL_SAMPLE_RATE) &&
+         (pulse <= (Nominal + Tolerance) / RAWSIGNAL_SAMPLE_RATE);
+}
+
+// Pulse in the window Min .. Max, in uSec, both included once in samples. For a bound that
+// excludes a length, give the length + RAWSIGNAL_SAMPLE_RATE as Min
+template <unsigned int Min, unsigned int Max>
+inline boolean LineCode_In(byte pulse)
+{
+  return (pulse >= Min / RAWSIGNAL_SAMPLE_RATE) && (pulse <= Max / RAWSIGNAL_SAMPLE_RATE);
+}
+
+// Short/long pulse with the split at the middle of Short and Long:
+// 0 short, 1 long, 2 out of Short - Tolerance .. Long + Tolerance
+template <unsigned int Short, unsigned int Long, unsigned int Tolerance>
+inline byte LineCode_Width(byte pulse)
+{
+  if (pulse > ((Short + Long) / 2) / RAWSIGNAL_SAMPLE_RATE)
+    return (pulse <= (Long + Tolerance) / RAWSIGNAL_SAMPLE_RATE) ? 1 : 2;
+  return (pulse >= ((Short > Tolerance) ? (Short - Tolerance) : 0) / RAWSIGNAL_SAMPLE_RATE) ? 0 : 2;
+}
+
+// Second pulse of a pair: the opposite of width, a pulse right at the middle being either
+template <unsigned int Short, unsigned int Long, unsigned int Tolerance>
+inline boolean LineCode_Opposite(byte pulse, byte width)
+{
+  if (pulse == ((Short + Long) / 2) / RAWSIGNAL_SAMPLE_RATE)
+    return true;
+  return LineCode_Width<Short, Long, Tolerance>(pulse) == (width ^ 1);
+}
+
+// Room in the packet for count pulses from pos
+inline boolean LineCode_Room(const RawSignalStruct *signal, int pos, int count)
+{
+  return (pos >= 1) && (pos + count - 1 <= signal->Number);
+}
+
+/*********************************************************************************************\
+ * PWM: one bit per pulse pair, long-short is 1, short-long is 0
+\*********************************************************************************************/
+template <unsigned int Short, unsigned int Long, unsigned int Tolerance>
+struct PwmDecoder
+{
+  template <unsigned int Bits>
+  static boolean Decode(const RawSignalStruct *signal, int pos, LineBits<Bits> &bits)
+  {
+    bits.Clear();
+    if (!LineCode_Room(signal, pos, Bits * 2))
+      return false;
+    for (const byte *pulse = &signal->Pulses[pos]; bits.Count < Bits; pulse += 2)
+    {
+      byte first = LineCode_Width<Short, Long, Tolerance>(pulse[0]);
+
+      if ((first > 1) || !LineCode_Opposite<Short, Long, Tolerance>(pulse[1], first))
+        return false;
+      bits.Add(first);
+    }
+    return true;
+  }
+};
+
+/*********************************************************************************************\
+ * PPM: one bit per pulse pair, the bit in the length of the first pulse (Zero or One),
+ * the second one (Mark) only separating the bits. Each has its own window, Min .. Max:
+ * the windows of Zero and One need not be the same width nor centred on a nominal length.
+\*********************************************************************************************/
+template <unsigned int MarkMin, unsigned int MarkMax,
+          unsigned int ZeroMin, unsigned int ZeroMax,
+          unsigned int OneMin, unsigned int OneMax>
+struct PpmDecoder
+{
+  template <unsigned int Bits>
+  static boolean Decode(const RawSignalStruct *signal, int pos, LineBits<Bits> &bits)
+  {
+    bits.Clear();
+    if (!LineCode_Room(signal, pos, Bits * 2))
+      return false;
+    for (const byte *pulse = &signal->Pulses[pos]; bits.Count < Bits; pulse += 2)
+    {
+      if (!LineCode_In<MarkMin, MarkMax>(pulse[1]))
+        return false;
+      if (LineCode_In<OneMin, OneMax>(pulse[0]))
+        bits.Add(1);
+      else if (LineCode_In<ZeroMin, ZeroMax>(pulse[0]))
+        bits.Add(0);
+      else
+        return false;
+    }
+    return true;
+  }
+};
+
+/*********************************************************************************************\
+ * Manchester: pulses of one or two half bits, a transition in the middle of each bit.
+ * High-low is 1, low-high is 0. Odd pulses are high, pos must be at the start of a bit.
+ * The ending pulse may hold the last half bit.
+\*********************************************************************************************/
+template <unsigned int Half, unsigned int Tolerance>
+struct ManchesterDecoder
+{
+  template <unsigned int Bits>
+  static boolean Decode(const RawSignalStruct *signal, int pos, LineBits<Bits> &bits)
+  {
+    byte pending = 2; // Level of the first half of the current bit, 2 between bits
+
+    bits.Clear();
+    if (!LineCode_Room(signal, pos, Bits))
+      return false;
+    for (int i = pos; bits.Count < Bits; i++)
+    {
+      byte level = i & 1;
+      byte halves;
+
+      if (i > signal->Number)
+        return false;
+      if (LineCode_Fits<Half, Tolerance>(signal->Pulses[i]))
+        halves = 1;
+      else if (LineCode_Fits<Half * 2, Tolerance * 2>(signal->Pulses[i]))
+        halves = 2;
+      else if ((i == signal->Number) && (pending != 2))
+        halves = 1; // Ending pulse, the last half bit is all we need of it
+      else
+        return false;
+
+      while (halves--)
+      {
+        if (pending == 2)
+          pending = level;
+        else if (pending == level)
+          return false; // No transition in the middle of the bit
+        else
+        {
+          bits.Add(pending);
+          pending = 2;
+          if (bits.Count == Bits)
+            break;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+/*********************************************************************************************\
+ * PT2262 tristate: two PWM pairs per symbol, short-long short-long is 0, long-short
+ * long-short is 1, short-long long-short is F. Symbols are stored as 2 bits: 00, 11, 01 (F).
+ * Bits is twice the number of symbols.
+\*********************************************************************************************/
+template <unsigned int Short, unsigned int Long, unsigned int Tolerance>
+struct TristateDecoder
+{
+  template <unsigned int Bits>
+  static boolean Decode(const RawSignalStruct *signal, int pos, LineBits<Bits> &bits)
+  {
+    bits.Clear();
+    if (!LineCode_Room(signal, pos, Bits * 2))
+      return false;
+    for (const byte *pulse = &signal->Pulses[pos]; bits.Count < Bits; pulse += 4)
+    {
+      byte first = LineCode_Width<Short, Long, Tolerance>(pulse[0]);
+      byte second = LineCode_Width<Short, Long, Tolerance>(pulse[2]);
+
+      if ((first > 1) || (second > 1) || (first > second)) // 10 is not a PT2262 symbol
+        return false;
+      if (!LineCode_Opposite<Short, Long, Tolerance>(pulse[1], first) ||
+          !LineCode_Opposite<Short, Long, Tolerance>(pulse[3], second))
+        return false;
+      bits.Add(first);
+      bits.Add(second);
+    }
+    return true;
+  }
+};
+
+#endif
@@ -6,1899 +6,515 @@
 // ************************************* //
 
 #include <Arduino.h>
+#include <stddef.h>
 #include "RFLink.h"
 #include "2_Signal.h"
+#include "2_Classify.h"
+#include "4_Display.h"
+#include "4_Event.h"
 #include "5_Plugin.h"
-#ifdef AUTOCONNECT_ENABLED
-#include "9_AutoConnect.h"
-#ifdef ESP8266
-#include <FS.h>
-#include <LittleFS.h>
-#elif ESP32
-#include <SPIFFS.h>
-#define LittleFS SPIFFS
-#endif // ESP8266
-#include <ArduinoJson.h>
-#endif // AUTOCONNECT
-
-boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-byte Plugin_id[PLUGIN_MAX];
-byte Plugin_State[PLUGIN_MAX];
-String Plugin_Description[PLUGIN_MAX];
-
-boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, char *); // Trasmit plugins
-byte PluginTX_id[PLUGIN_TX_MAX];
-byte PluginTX_State[PLUGIN_TX_MAX];
-
-boolean RFDebug = RFDebug_0;     // debug RF signals with plugin 001 (no decode)
-boolean QRFDebug = QRFDebug_0;   // debug RF signals with plugin 001 but no multiplication (faster?, compact)
-boolean RFUDebug = RFUDebug_0;   // debug RF signals with plugin 254 (decode 1st)
-boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no multiplication (faster?, compact)
-
-
-/**********************************************************************************************\
- * Load plugins
-\*********************************************************************************************/
-#include "./Plugins/_Plugin_Config_01.h"
-
-#ifdef PLUGIN_001
-#include "./Plugins/Plugin_001.c"
-#endif
-
-#ifdef PLUGIN_002
-#include "./Plugins/Plugin_002.c"
-#endif
-
-#ifdef PLUGIN_003
-#include "./Plugins/Plugin_003.c"
-#endif
-
-#ifdef PLUGIN_004
-#include "./Plugins/Plugin_004.c"
-#endif
-
-#ifdef PLUGIN_005
-#include "./Plugins/Plugin_005.c"
-#endif
-
-#ifdef PLUGIN_006
-#include "./Plugins/Plugin_006.c"
-#endif
-
-#ifdef PLUGIN_007
-#include "./Plugins/Plugin_007.c"
-#endif
-
-#ifdef PLUGIN_008
-#include "./Plugins/Plugin_008.c"
-#endif
-
-#ifdef PLUGIN_009
-#include "./Plugins/Plugin_009.c"
-#endif
-
-#ifdef PLUGIN_010
-#include "./Plugins/Plugin_010.c"
-#endif
-
-#ifdef PLUGIN_011
-#include "./Plugins/Plugin_011.c"
-#endif
-
-#ifdef PLUGIN_012
-#include "./Plugins/Plugin_012.c"
-#endif
-
-#ifdef PLUGIN_013
-#include "./Plugins/Plugin_013.c"
-#endif
-
-#ifdef PLUGIN_014
-#include "./Plugins/Plugin_014.c"
-#endif
-
-#ifdef PLUGIN_015
-#include "./Plugins/Plugin_015.c"
-#endif
-
-#ifdef PLUGIN_016
-#include "./Plugins/Plugin_016.c"
-#endif
-
-#ifdef PLUGIN_017
-#include "./Plugins/Plugin_017.c"
-#endif
-
-#ifdef PLUGIN_018
-#include "./Plugins/Plugin_018.c"
-#endif
-
-#ifdef PLUGIN_019
-#include "./Plugins/Plugin_019.c"
-#endif
-
-#ifdef PLUGIN_020
-#include "./Plugins/Plugin_020.c"
-#endif
-
-#ifdef PLUGIN_021
-#include "./Plugins/Plugin_021.c"
-#endif
-
-#ifdef PLUGIN_022
-#include "./Plugins/Plugin_022.c"
-#endif
-
-#ifdef PLUGIN_023
-#include "./Plugins/Plugin_023.c"
-#endif
-
-#ifdef PLUGIN_024
-#include "./Plugins/Plugin_024.c"
-#endif
-
-#ifdef PLUGIN_025
-#include "./Plugins/Plugin_025.c"
-#endif
-
-#ifdef PLUGIN_026
-#include "./Plugins/Plugin_026.c"
-#endif
-
-#ifdef PLUGIN_027
-#include "./Plugins/Plugin_027.c"
-#endif
-
-#ifdef PLUGIN_028
-#include "./Plugins/Plugin_028.c"
-#endif
-
-#ifdef PLUGIN_029
-#include "./Plugins/Plugin_029.c"
-#endif
-
-#ifdef PLUGIN_030
-#include "./Plugins/Plugin_030.c"
-#endif
-
-#ifdef PLUGIN_031
-#include "./Plugins/Plugin_031.c"
-#endif
-
-#ifdef PLUGIN_032
-#include "./Plugins/Plugin_032.c"
-#endif
-
-#ifdef PLUGIN_033
-#include "./Plugins/Plugin_033.c"
-#endif
-
-#ifdef PLUGIN_034
-#include "./Plugins/Plugin_034.c"
-#endif
-
-#ifdef PLUGIN_035
-#include "./Plugins/Plugin_035.c"
-#endif
-
-#ifdef PLUGIN_036
-#include "./Plugins/Plugin_036.c"
-#endif
-
-#ifdef PLUGIN_037
-#include "./Plugins/Plugin_037.c"
-#endif
-
-#ifdef PLUGIN_038
-#include "./Plugins/Plugin_038.c"
-#endif
-
-#ifdef PLUGIN_039
-#include "./Plugins/Plugin_039.c"
-#endif
-
-#ifdef PLUGIN_040
-#include "./Plugins/Plugin_040.c"
-#endif
-
-#ifdef PLUGIN_041
-#include "./Plugins/Plugin_041.c"
-#endif
-
-#ifdef PLUGIN_042
-#include "./Plugins/Plugin_042.c"
-#endif
-
-#ifdef PLUGIN_043
-#include "./Plugins/Plugin_043.c"
-#endif
-
-#ifdef PLUGIN_044
-#include "./Plugins/Plugin_044.c"
-#endif
-
-#ifdef PLUGIN_045
-#include "./Plugins/Plugin_045.c"
-#endif
-
-#ifdef PLUGIN_046
-#include "./Plugins/Plugin_046.c"
-#endif
-
-#ifdef PLUGIN_047
-#include "./Plugins/Plugin_047.c"
-#endif
-
-#ifdef PLUGIN_048
-#include "./Plugins/Plugin_048.c"
-#endif
-
-#ifdef PLUGIN_049
-#include "./Plugins/Plugin_049.c"
-#endif
-
-#ifdef PLUGIN_050
-#include "./Plugins/Plugin_050.c"
-#endif
-
-#ifdef PLUGIN_051
-#include "./Plugins/Plugin_051.c"
-#endif
-
-#ifdef PLUGIN_052
-#include "./Plugins/Plugin_052.c"
-#endif
-
-#ifdef PLUGIN_053
-#include "./Plugins/Plugin_053.c"
-#endif
-
-#ifdef PLUGIN_054
-#include "./Plugins/Plugin_054.c"
-#endif
-
-#ifdef PLUGIN_055
-#include "./Plugins/Plugin_055.c"
-#endif
-
-#ifdef PLUGIN_056
-#include "./Plugins/Plugin_056.c"
-#endif
-
-#ifdef PLUGIN_057
-#include "./Plugins/Plugin_057.c"
-#endif
-
-#ifdef PLUGIN_058
-#include "./Plugins/Plugin_058.c"
-#endif
-
-#ifdef PLUGIN_059
-#include "./Plugins/Plugin_059.c"
-#endif
-
-#ifdef PLUGIN_060
-#include "./Plugins/Plugin_060.c"
-#endif
-
-#ifdef PLUGIN_061
-#include "./Plugins/Plugin_061.c"
-#endif
-
-#ifdef PLUGIN_062
-#include "./Plugins/Plugin_062.c"
-#endif
-
-#ifdef PLUGIN_063
-#include "./Plugins/Plugin_063.c"
-#endif
-
-#ifdef PLUGIN_064
-#include "./Plugins/Plugin_064.c"
-#endif
-
-#ifdef PLUGIN_065
-#include "./Plugins/Plugin_065.c"
-#endif
-
-#ifdef PLUGIN_066
-#include "./Plugins/Plugin_066.c"
-#endif
-
-#ifdef PLUGIN_067
-#include "./Plugins/Plugin_067.c"
-#endif
-
-#ifdef PLUGIN_068
-#include "./Plugins/Plugin_068.c"
-#endif
-
-#ifdef PLUGIN_069
-#include "./Plugins/Plugin_069.c"
-#endif
-
-#ifdef PLUGIN_070
-#include "./Plugins/Plugin_070.c"
-#endif
-
-#ifdef PLUGIN_071
-#include "./Plugins/Plugin_071.c"
-#endif
-
-#ifdef PLUGIN_072
-#include "./Plugins/Plugin_072.c"
-#endif
-
-#ifdef PLUGIN_073
-#include "./Plugins/Plugin_073.c"
-#endif
-
-#ifdef PLUGIN_074
-#include "./Plugins/Plugin_074.c"
-#endif
-
-#ifdef PLUGIN_075
-#include "./Plugins/Plugin_075.c"
-#endif
-
-#ifdef PLUGIN_076
-#include "./Plugins/Plugin_076.c"
-#endif
-
-#ifdef PLUGIN_077
-#include "./Plugins/Plugin_077.c"
-#endif
-
-#ifdef PLUGIN_078
-#include "./Plugins/Plugin_078.c"
-#endif
-
-#ifdef PLUGIN_079
-#include "./Plugins/Plugin_079.c"
-#endif
-
-#ifdef PLUGIN_080
-#include "./Plugins/Plugin_080.c"
-#endif
-
-#ifdef PLUGIN_081
-#include "./Plugins/Plugin_081.c"
-#endif
-
-#ifdef PLUGIN_082
-#include "./Plugins/Plugin_082.c"
-#endif
-
-#ifdef PLUGIN_083
-#include "./Plugins/Plugin_083.c"
-#endif
-
-#ifdef PLUGIN_084
-#include "./Plugins/Plugin_084.c"
-#endif
-
-#ifdef PLUGIN_085
-#include "./Plugins/Plugin_085.c"
-#endif
-
-#ifdef PLUGIN_086
-#include "./Plugins/Plugin_086.c"
-#endif
-
-#ifdef PLUGIN_087
-#include "./Plugins/Plugin_087.c"
-#endif
-
-#ifdef PLUGIN_088
-#include "./Plugins/Plugin_088.c"
-#endif
-
-#ifdef PLUGIN_089
-#include "./Plugins/Plugin_089.c"
-#endif
-
-#ifdef PLUGIN_090
-#include "./Plugins/Plugin_090.c"
-#endif
-
-#ifdef PLUGIN_091
-#include "./Plugins/Plugin_091.c"
-#endif
-
-#ifdef PLUGIN_092
-#include "./Plugins/Plugin_092.c"
-#endif
-
-#ifdef PLUGIN_093
-#include "./Plugins/Plugin_093.c"
-#endif
-
-#ifdef PLUGIN_094
-#include "./Plugins/Plugin_094.c"
-#endif
-
-#ifdef PLUGIN_095
-#include "./Plugins/Plugin_095.c"
-#endif
-
-#ifdef PLUGIN_096
-#include "./Plugins/Plugin_096.c"
-#endif
-
-#ifdef PLUGIN_097
-#include "./Plugins/Plugin_097.c"
-#endif
-
-#ifdef PLUGIN_098
-#include "./Plugins/Plugin_098.c"
-#endif
-
-#ifdef PLUGIN_099
-#include "./Plugins/Plugin_099.c"
-#endif
-
-#ifdef PLUGIN_100
-#include "./Plugins/Plugin_100.c"
-#endif
-
-#ifdef PLUGIN_101
-#include "./Plugins/Plugin_101.c"
-#endif
-
-#ifdef PLUGIN_102
-#include "./Plugins/Plugin_102.c"
-#endif
-
-#ifdef PLUGIN_103
-#include "./Plugins/Plugin_103.c"
-#endif
-
-#ifdef PLUGIN_104
-#include "./Plugins/Plugin_104.c"
-#endif
-
-#ifdef PLUGIN_105
-#include "./Plugins/Plugin_105.c"
-#endif
-
-#ifdef PLUGIN_106
-#include "./Plugins/Plugin_106.c"
-#endif
-
-#ifdef PLUGIN_107
-#include "./Plugins/Plugin_107.c"
-#endif
-
-#ifdef PLUGIN_108
-#include "./Plugins/Plugin_108.c"
-#endif
-
-#ifdef PLUGIN_109
-#include "./Plugins/Plugin_109.c"
-#endif
-
-#ifdef PLUGIN_110
-#include "./Plugins/Plugin_110.c"
-#endif
-
-#ifdef PLUGIN_111
-#include "./Plugins/Plugin_111.c"
-#endif
-
-#ifdef PLUGIN_112
-#include "./Plugins/Plugin_112.c"
-#endif
-
-#ifdef PLUGIN_113
-#include "./Plugins/Plugin_113.c"
-#endif
-
-#ifdef PLUGIN_114
-#include "./Plugins/Plugin_114.c"
-#endif
-
-#ifdef PLUGIN_115
-#include "./Plugins/Plugin_115.c"
-#endif
-
-#ifdef PLUGIN_116
-#include "./Plugins/Plugin_116.c"
-#endif
-
-#ifdef PLUGIN_117
-#include "./Plugins/Plugin_117.c"
-#endif
-
-#ifdef PLUGIN_118
-#include "./Plugins/Plugin_118.c"
-#endif
-
-#ifdef PLUGIN_119
-#include "./Plugins/Plugin_119.c"
-#endif
-
-#ifdef PLUGIN_120
-#include "./Plugins/Plugin_120.c"
-#endif
-
-#ifdef PLUGIN_250
-#include "./Plugins/Plugin_250.c"
-#endif
-
-#ifdef PLUGIN_251
-#include "./Plugins/Plugin_251.c"
-#endif
-
-#ifdef PLUGIN_252
-#include "./Plugins/Plugin_252.c"
-#endif
-
-#ifdef PLUGIN_253
-#include "./Plugins/Plugin_253.c"
-#endif
-
-#ifdef PLUGIN_254
-#include "./Plugins/Plugin_254.c"
-#endif
-
-#ifdef PLUGIN_255
-#include "./Plugins/Plugin_255.c"
-#endif
-/*********************************************************************************************/
-void PluginInit(void)
-{
-  byte x;
-
-  // Wis de pointertabel voor de plugins.
-  for (x = 0; x < PLUGIN_MAX; x++)
-  {
-    Plugin_ptr[x] = 0;
-    Plugin_id[x] = 0;
-    Plugin_State[x] = P_Enabled;
-  }
-
-  x = 0;
-
-#ifdef PLUGIN_001
-  Plugin_id[x] = 1;
-  Plugin_Description[x] = PLUGIN_DESC_001;
-  Plugin_ptr[x++] = &Plugin_001;
-#endif
-
-#ifdef PLUGIN_002
-  Plugin_id[x] = 2;
-  Plugin_Description[x] = PLUGIN_DESC_002;
-  Plugin_ptr[x++] = &Plugin_002;
-#endif
-
-#ifdef PLUGIN_003
-  Plugin_id[x] = 3;
-  Plugin_Description[x] = PLUGIN_DESC_003;
-  Plugin_ptr[x++] = &Plugin_003;
-#endif
-
-#ifdef PLUGIN_004
-  Plugin_id[x] = 4;
-  Plugin_Description[x] = PLUGIN_DESC_004;
-  Plugin_ptr[x++] = &Plugin_004;
-#endif
-
-#ifdef PLUGIN_005
-  Plugin_id[x] = 5;
-  Plugin_Description[x] = PLUGIN_DESC_005;
-  Plugin_ptr[x++] = &Plugin_005;
-#endif
-
-#ifdef PLUGIN_006
-  Plugin_id[x] = 6;
-  Plugin_Description[x] = PLUGIN_DESC_006;
-  Plugin_ptr[x++] = &Plugin_006;
-#endif
-
-#ifdef PLUGIN_007
-  Plugin_id[x] = 7;
-  Plugin_Description[x] = PLUGIN_DESC_007;
-  Plugin_ptr[x++] = &Plugin_007;
-#endif
-
-#ifdef PLUGIN_008
-  Plugin_id[x] = 8;
-  Plugin_Description[x] = PLUGIN_DESC_008;
-  Plugin_ptr[x++] = &Plugin_008;
-#endif
-
-#ifdef PLUGIN_009
-  Plugin_id[x] = 9;
-  Plugin_Description[x] = PLUGIN_DESC_009;
-  Plugin_ptr[x++] = &Plugin_009;
-#endif
-
-#ifdef PLUGIN_010
-  Plugin_id[x] = 10;
-  Plugin_Description[x] = PLUGIN_DESC_010;
-  Plugin_ptr[x++] = &Plugin_010;
-#endif
-
-#ifdef PLUGIN_011
-  Plugin_id[x] = 11;
-  Plugin_Description[x] = PLUGIN_DESC_011;
-  Plugin_ptr[x++] = &Plugin_011;
-#endif
-
-#ifdef PLUGIN_012
-  Plugin_id[x] = 12;
-  Plugin_Description[x] = PLUGIN_DESC_012;
-  Plugin_ptr[x++] = &Plugin_012;
-#endif
-
-#ifdef PLUGIN_013
-  Plugin_id[x] = 13;
-  Plugin_Description[x] = PLUGIN_DESC_013;
-  Plugin_ptr[x++] = &Plugin_013;
-#endif
-
-#ifdef PLUGIN_014
-  Plugin_id[x] = 14;
-  Plugin_Description[x] = PLUGIN_DESC_014;
-  Plugin_ptr[x++] = &Plugin_014;
-#endif
-
-#ifdef PLUGIN_015
-  Plugin_id[x] = 15;
-  Plugin_Description[x] = PLUGIN_DESC_015;
-  Plugin_ptr[x++] = &Plugin_015;
-#endif
-
-#ifdef PLUGIN_016
-  Plugin_id[x] = 16;
-  Plugin_Description[x] = PLUGIN_DESC_016;
-  Plugin_ptr[x++] = &Plugin_016;
-#endif
-
-#ifdef PLUGIN_017
-  Plugin_id[x] = 17;
-  Plugin_Description[x] = PLUGIN_DESC_017;
-  Plugin_ptr[x++] = &Plugin_017;
-#endif
-
-#ifdef PLUGIN_018
-  Plugin_id[x] = 18;
-  Plugin_Description[x] = PLUGIN_DESC_018;
-  Plugin_ptr[x++] = &Plugin_018;
-#endif
-
-#ifdef PLUGIN_019
-  Plugin_id[x] = 19;
-  Plugin_Description[x] = PLUGIN_DESC_019;
-  Plugin_ptr[x++] = &Plugin_019;
-#endif
-
-#ifdef PLUGIN_020
-  Plugin_id[x] = 20;
-  Plugin_Description[x] = PLUGIN_DESC_020;
-  Plugin_ptr[x++] = &Plugin_020;
-#endif
-
-#ifdef PLUGIN_021
-  Plugin_id[x] = 21;
-  Plugin_Description[x] = PLUGIN_DESC_021;
-  Plugin_ptr[x++] = &Plugin_021;
-#endif
-
-#ifdef PLUGIN_022
-  Plugin_id[x] = 22;
-  Plugin_Description[x] = PLUGIN_DESC_022;
-  Plugin_ptr[x++] = &Plugin_022;
-#endif
-
-#ifdef PLUGIN_023
-  Plugin_id[x] = 23;
-  Plugin_Description[x] = PLUGIN_DESC_023;
-  Plugin_ptr[x++] = &Plugin_023;
-#endif
-
-#ifdef PLUGIN_024
-  Plugin_id[x] = 24;
-  Plugin_Description[x] = PLUGIN_DESC_024;
-  Plugin_ptr[x++] = &Plugin_024;
-#endif
-
-#ifdef PLUGIN_025
-  Plugin_id[x] = 25;
-  Plugin_Description[x] = PLUGIN_DESC_025;
-  Plugin_ptr[x++] = &Plugin_025;
-#endif
-
-#ifdef PLUGIN_026
-  Plugin_id[x] = 26;
-  Plugin_Description[x] = PLUGIN_DESC_026;
-  Plugin_ptr[x++] = &Plugin_026;
-#endif
-
-#ifdef PLUGIN_027
-  Plugin_id[x] = 27;
-  Plugin_Description[x] = PLUGIN_DESC_027;
-  Plugin_ptr[x++] = &Plugin_027;
-#endif
-
-#ifdef PLUGIN_028
-  Plugin_id[x] = 28;
-  Plugin_Description[x] = PLUGIN_DESC_028;
-  Plugin_ptr[x++] = &Plugin_028;
-#endif
-
-#ifdef PLUGIN_029
-  Plugin_id[x] = 29;
-  Plugin_Description[x] = PLUGIN_DESC_029;
-  Plugin_ptr[x++] = &Plugin_029;
-#endif
-
-#ifdef PLUGIN_030
-  Plugin_id[x] = 30;
-  Plugin_Description[x] = PLUGIN_DESC_030;
-  Plugin_ptr[x++] = &Plugin_030;
-#endif
-
-#ifdef PLUGIN_031
-  Plugin_id[x] = 31;
-  Plugin_Description[x] = PLUGIN_DESC_031;
-  Plugin_ptr[x++] = &Plugin_031;
-#endif
-
-#ifdef PLUGIN_032
-  Plugin_id[x] = 32;
-  Plugin_Description[x] = PLUGIN_DESC_032;
-  Plugin_ptr[x++] = &Plugin_032;
-#endif
-
-#ifdef PLUGIN_033
-  Plugin_id[x] = 33;
-  Plugin_Description[x] = PLUGIN_DESC_033;
-  Plugin_ptr[x++] = &Plugin_033;
-#endif
-
-#ifdef PLUGIN_034
-  Plugin_id[x] = 34;
-  Plugin_Description[x] = PLUGIN_DESC_034;
-  Plugin_ptr[x++] = &Plugin_034;
-#endif
-
-#ifdef PLUGIN_035
-  Plugin_id[x] = 35;
-  Plugin_Description[x] = PLUGIN_DESC_035;
-  Plugin_ptr[x++] = &Plugin_035;
-#endif
-
-#ifdef PLUGIN_036
-  Plugin_id[x] = 36;
-  Plugin_Description[x] = PLUGIN_DESC_036;
-  Plugin_ptr[x++] = &Plugin_036;
-#endif
-
-#ifdef PLUGIN_037
-  Plugin_id[x] = 37;
-  Plugin_Description[x] = PLUGIN_DESC_037;
-  Plugin_ptr[x++] = &Plugin_037;
-#endif
-
-#ifdef PLUGIN_038
-  Plugin_id[x] = 38;
-  Plugin_Description[x] = PLUGIN_DESC_038;
-  Plugin_ptr[x++] = &Plugin_038;
-#endif
-
-#ifdef PLUGIN_039
-  Plugin_id[x] = 39;
-  Plugin_Description[x] = PLUGIN_DESC_039;
-  Plugin_ptr[x++] = &Plugin_039;
-#endif
-
-#ifdef PLUGIN_040
-  Plugin_id[x] = 40;
-  Plugin_Description[x] = PLUGIN_DESC_040;
-  Plugin_ptr[x++] = &Plugin_040;
-#endif
-
-#ifdef PLUGIN_041
-  Plugin_id[x] = 41;
-  Plugin_Description[x] = PLUGIN_DESC_041;
-  Plugin_ptr[x++] = &Plugin_041;
-#endif
-
-#ifdef PLUGIN_042
-  Plugin_id[x] = 42;
-  Plugin_Description[x] = PLUGIN_DESC_042;
-  Plugin_ptr[x++] = &Plugin_042;
-#endif
-
-#ifdef PLUGIN_043
-  Plugin_id[x] = 43;
-  Plugin_Description[x] = PLUGIN_DESC_043;
-  Plugin_ptr[x++] = &Plugin_043;
-#endif
-
-#ifdef PLUGIN_044
-  Plugin_id[x] = 44;
-  Plugin_Description[x] = PLUGIN_DESC_044;
-  Plugin_ptr[x++] = &Plugin_044;
-#endif
-
-#ifdef PLUGIN_045
-  Plugin_id[x] = 45;
-  Plugin_Description[x] = PLUGIN_DESC_045;
-  Plugin_ptr[x++] = &Plugin_045;
-#endif
-
-#ifdef PLUGIN_046
-  Plugin_id[x] = 46;
-  Plugin_Description[x] = PLUGIN_DESC_046;
-  Plugin_ptr[x++] = &Plugin_046;
-#endif
-
-#ifdef PLUGIN_047
-  Plugin_id[x] = 47;
-  Plugin_Description[x] = PLUGIN_DESC_047;
-  Plugin_ptr[x++] = &Plugin_047;
-#endif
-
-#ifdef PLUGIN_048
-  Plugin_id[x] = 48;
-  Plugin_Description[x] = PLUGIN_DESC_048;
-  Plugin_ptr[x++] = &Plugin_048;
-#endif
-
-#ifdef PLUGIN_049
-  Plugin_id[x] = 49;
-  Plugin_Description[x] = PLUGIN_DESC_049;
-  Plugin_ptr[x++] = &Plugin_049;
-#endif
-
-#ifdef PLUGIN_050
-  Plugin_id[x] = 50;
-  Plugin_Description[x] = PLUGIN_DESC_050;
-  Plugin_ptr[x++] = &Plugin_050;
-#endif
-
-#ifdef PLUGIN_051
-  Plugin_id[x] = 51;
-  Plugin_Description[x] = PLUGIN_DESC_051;
-  Plugin_ptr[x++] = &Plugin_051;
-#endif
-
-#ifdef PLUGIN_052
-  Plugin_id[x] = 52;
-  Plugin_Description[x] = PLUGIN_DESC_052;
-  Plugin_ptr[x++] = &Plugin_052;
-#endif
-
-#ifdef PLUGIN_053
-  Plugin_id[x] = 53;
-  Plugin_Description[x] = PLUGIN_DESC_053;
-  Plugin_ptr[x++] = &Plugin_053;
-#endif
-
-#ifdef PLUGIN_054
-  Plugin_id[x] = 54;
-  Plugin_Description[x] = PLUGIN_DESC_054;
-  Plugin_ptr[x++] = &Plugin_054;
-#endif
-
-#ifdef PLUGIN_055
-  Plugin_id[x] = 55;
-  Plugin_Description[x] = PLUGIN_DESC_055;
-  Plugin_ptr[x++] = &Plugin_055;
-#endif
-
-#ifdef PLUGIN_056
-  Plugin_id[x] = 56;
-  Plugin_Description[x] = PLUGIN_DESC_056;
-  Plugin_ptr[x++] = &Plugin_056;
-#endif
-
-#ifdef PLUGIN_057
-  Plugin_id[x] = 57;
-  Plugin_Description[x] = PLUGIN_DESC_057;
-  Plugin_ptr[x++] = &Plugin_057;
-#endif
-
-#ifdef PLUGIN_058
-  Plugin_id[x] = 58;
-  Plugin_Description[x] = PLUGIN_DESC_058;
-  Plugin_ptr[x++] = &Plugin_058;
-#endif
-
-#ifdef PLUGIN_059
-  Plugin_id[x] = 59;
-  Plugin_Description[x] = PLUGIN_DESC_059;
-  Plugin_ptr[x++] = &Plugin_059;
-#endif
-
-#ifdef PLUGIN_060
-  Plugin_id[x] = 60;
-  Plugin_Description[x] = PLUGIN_DESC_060;
-  Plugin_ptr[x++] = &Plugin_060;
-#endif
-
-#ifdef PLUGIN_061
-  Plugin_id[x] = 61;
-  Plugin_Description[x] = PLUGIN_DESC_061;
-  Plugin_ptr[x++] = &Plugin_061;
-#endif
-
-#ifdef PLUGIN_062
-  Plugin_id[x] = 62;
-  Plugin_Description[x] = PLUGIN_DESC_062;
-  Plugin_ptr[x++] = &Plugin_062;
-#endif
-
-#ifdef PLUGIN_063
-  Plugin_id[x] = 63;
-  Plugin_Description[x] = PLUGIN_DESC_063;
-  Plugin_ptr[x++] = &Plugin_063;
-#endif
-
-#ifdef PLUGIN_064
-  Plugin_id[x] = 64;
-  Plugin_Description[x] = PLUGIN_DESC_064;
-  Plugin_ptr[x++] = &Plugin_064;
-#endif
-
-#ifdef PLUGIN_065
-  Plugin_id[x] = 65;
-  Plugin_Description[x] = PLUGIN_DESC_065;
-  Plugin_ptr[x++] = &Plugin_065;
-#endif
-
-#ifdef PLUGIN_066
-  Plugin_id[x] = 66;
-  Plugin_Description[x] = PLUGIN_DESC_066;
-  Plugin_ptr[x++] = &Plugin_066;
-#endif
-
-#ifdef PLUGIN_067
-  Plugin_id[x] = 67;
-  Plugin_Description[x] = PLUGIN_DESC_067;
-  Plugin_ptr[x++] = &Plugin_067;
-#endif
-
-#ifdef PLUGIN_068
-  Plugin_id[x] = 68;
-  Plugin_Description[x] = PLUGIN_DESC_068;
-  Plugin_ptr[x++] = &Plugin_068;
-#endif
-
-#ifdef PLUGIN_069
-  Plugin_id[x] = 69;
-  Plugin_Description[x] = PLUGIN_DESC_069;
-  Plugin_ptr[x++] = &Plugin_069;
-#endif
-
-#ifdef PLUGIN_070
-  Plugin_id[x] = 70;
-  Plugin_Description[x] = PLUGIN_DESC_070;
-  Plugin_ptr[x++] = &Plugin_070;
-#endif
-
-#ifdef PLUGIN_071
-  Plugin_id[x] = 71;
-  Plugin_Description[x] = PLUGIN_DESC_071;
-  Plugin_ptr[x++] = &Plugin_071;
-#endif
-
-#ifdef PLUGIN_072
-  Plugin_id[x] = 72;
-  Plugin_Description[x] = PLUGIN_DESC_072;
-  Plugin_ptr[x++] = &Plugin_072;
-#endif
-
-#ifdef PLUGIN_073
-  Plugin_id[x] = 73;
-  Plugin_Description[x] = PLUGIN_DESC_073;
-  Plugin_ptr[x++] = &Plugin_073;
-#endif
-
-#ifdef PLUGIN_074
-  Plugin_id[x] = 74;
-  Plugin_Description[x] = PLUGIN_DESC_074;
-  Plugin_ptr[x++] = &Plugin_074;
-#endif
-
-#ifdef PLUGIN_075
-  Plugin_id[x] = 75;
-  Plugin_Description[x] = PLUGIN_DESC_075;
-  Plugin_ptr[x++] = &Plugin_075;
-#endif
-
-#ifdef PLUGIN_076
-  Plugin_id[x] = 76;
-  Plugin_Description[x] = PLUGIN_DESC_076;
-  Plugin_ptr[x++] = &Plugin_076;
-#endif
-
-#ifdef PLUGIN_077
-  Plugin_id[x] = 77;
-  Plugin_Description[x] = PLUGIN_DESC_077;
-  Plugin_ptr[x++] = &Plugin_077;
-#endif
-
-#ifdef PLUGIN_078
-  Plugin_id[x] = 78;
-  Plugin_Description[x] = PLUGIN_DESC_078;
-  Plugin_ptr[x++] = &Plugin_078;
-#endif
-
-#ifdef PLUGIN_079
-  Plugin_id[x] = 79;
-  Plugin_Description[x] = PLUGIN_DESC_079;
-  Plugin_ptr[x++] = &Plugin_079;
-#endif
-
-#ifdef PLUGIN_080
-  Plugin_id[x] = 80;
-  Plugin_Description[x] = PLUGIN_DESC_080;
-  Plugin_ptr[x++] = &Plugin_080;
-#endif
-
-#ifdef PLUGIN_081
-  Plugin_id[x] = 81;
-  Plugin_Description[x] = PLUGIN_DESC_081;
-  Plugin_ptr[x++] = &Plugin_081;
-#endif
-
-#ifdef PLUGIN_082
-  Plugin_id[x] = 82;
-  Plugin_Description[x] = PLUGIN_DESC_082;
-  Plugin_ptr[x++] = &Plugin_082;
-#endif
-
-#ifdef PLUGIN_083
-  Plugin_id[x] = 83;
-  Plugin_Description[x] = PLUGIN_DESC_083;
-  Plugin_ptr[x++] = &Plugin_083;
-#endif
-
-#ifdef PLUGIN_084
-  Plugin_id[x] = 84;
-  Plugin_Description[x] = PLUGIN_DESC_084;
-  Plugin_ptr[x++] = &Plugin_084;
-#endif
-
-#ifdef PLUGIN_085
-  Plugin_id[x] = 85;
-  Plugin_Description[x] = PLUGIN_DESC_085;
-  Plugin_ptr[x++] = &Plugin_085;
-#endif
-
-#ifdef PLUGIN_086
-  Plugin_id[x] = 86;
-  Plugin_Description[x] = PLUGIN_DESC_086;
-  Plugin_ptr[x++] = &Plugin_086;
-#endif
-
-#ifdef PLUGIN_087
-  Plugin_id[x] = 87;
-  Plugin_Description[x] = PLUGIN_DESC_087;
-  Plugin_ptr[x++] = &Plugin_087;
-#endif
-
-#ifdef PLUGIN_088
-  Plugin_id[x] = 88;
-  Plugin_Description[x] = PLUGIN_DESC_088;
-  Plugin_ptr[x++] = &Plugin_088;
-#endif
-
-#ifdef PLUGIN_089
-  Plugin_id[x] = 89;
-  Plugin_Description[x] = PLUGIN_DESC_089;
-  Plugin_ptr[x++] = &Plugin_089;
-#endif
-
-#ifdef PLUGIN_090
-  Plugin_id[x] = 90;
-  Plugin_Description[x] = PLUGIN_DESC_090;
-  Plugin_ptr[x++] = &Plugin_090;
-#endif
-
-#ifdef PLUGIN_091
-  Plugin_id[x] = 91;
-  Plugin_Description[x] = PLUGIN_DESC_091;
-  Plugin_ptr[x++] = &Plugin_091;
-#endif
-
-#ifdef PLUGIN_092
-  Plugin_id[x] = 92;
-  Plugin_Description[x] = PLUGIN_DESC_092;
-  Plugin_ptr[x++] = &Plugin_092;
-#endif
-
-#ifdef PLUGIN_093
-  Plugin_id[x] = 93;
-  Plugin_Description[x] = PLUGIN_DESC_093;
-  Plugin_ptr[x++] = &Plugin_093;
-#endif
-
-#ifdef PLUGIN_094
-  Plugin_id[x] = 94;
-  Plugin_Description[x] = PLUGIN_DESC_094;
-  Plugin_ptr[x++] = &Plugin_094;
-#endif
-
-#ifdef PLUGIN_095
-  Plugin_id[x] = 95;
-  Plugin_Description[x] = PLUGIN_DESC_095;
-  Plugin_ptr[x++] = &Plugin_095;
-#endif
-
-#ifdef PLUGIN_096
-  Plugin_id[x] = 96;
-  Plugin_Description[x] = PLUGIN_DESC_096;
-  Plugin_ptr[x++] = &Plugin_096;
-#endif
-
-#ifdef PLUGIN_097
-  Plugin_id[x] = 97;
-  Plugin_Description[x] = PLUGIN_DESC_097;
-  Plugin_ptr[x++] = &Plugin_097;
-#endif
-
-#ifdef PLUGIN_098
-  Plugin_id[x] = 98;
-  Plugin_Description[x] = PLUGIN_DESC_098;
-  Plugin_ptr[x++] = &Plugin_098;
-#endif
-
-#ifdef PLUGIN_099
-  Plugin_id[x] = 99;
-  Plugin_Description[x] = PLUGIN_DESC_099;
-  Plugin_ptr[x++] = &Plugin_099;
-#endif
-
-#ifdef PLUGIN_100
-  Plugin_id[x] = 100;
-  Plugin_Description[x] = PLUGIN_DESC_100;
-  Plugin_ptr[x++] = &Plugin_100;
-#endif
-
-#ifdef PLUGIN_101
-  Plugin_id[x] = 101;
-  Plugin_Description[x] = PLUGIN_DESC_101;
-  Plugin_ptr[x++] = &Plugin_101;
-#endif
-
-#ifdef PLUGIN_102
-  Plugin_id[x] = 102;
-  Plugin_Description[x] = PLUGIN_DESC_102;
-  Plugin_ptr[x++] = &Plugin_102;
-#endif
-
-#ifdef PLUGIN_103
-  Plugin_id[x] = 103;
-  Plugin_Description[x] = PLUGIN_DESC_103;
-  Plugin_ptr[x++] = &Plugin_103;
-#endif
-
-#ifdef PLUGIN_104
-  Plugin_id[x] = 104;
-  Plugin_Description[x] = PLUGIN_DESC_104;
-  Plugin_ptr[x++] = &Plugin_104;
-#endif
-
-#ifdef PLUGIN_105
-  Plugin_id[x] = 105;
-  Plugin_Description[x] = PLUGIN_DESC_105;
-  Plugin_ptr[x++] = &Plugin_105;
-#endif
-
-#ifdef PLUGIN_106
-  Plugin_id[x] = 106;
-  Plugin_Description[x] = PLUGIN_DESC_106;
-  Plugin_ptr[x++] = &Plugin_106;
-#endif
-
-#ifdef PLUGIN_107
-  Plugin_id[x] = 107;
-  Plugin_Description[x] = PLUGIN_DESC_107;
-  Plugin_ptr[x++] = &Plugin_107;
-#endif
-
-#ifdef PLUGIN_108
-  Plugin_id[x] = 108;
-  Plugin_Description[x] = PLUGIN_DESC_108;
-  Plugin_ptr[x++] = &Plugin_108;
-#endif
-
-#ifdef PLUGIN_109
-  Plugin_id[x] = 109;
-  Plugin_Description[x] = PLUGIN_DESC_109;
-  Plugin_ptr[x++] = &Plugin_109;
-#endif
-
-#ifdef PLUGIN_110
-  Plugin_id[x] = 110;
-  Plugin_Description[x] = PLUGIN_DESC_110;
-  Plugin_ptr[x++] = &Plugin_110;
-#endif
-
-#ifdef PLUGIN_111
-  Plugin_id[x] = 111;
-  Plugin_Description[x] = PLUGIN_DESC_111;
-  Plugin_ptr[x++] = &Plugin_111;
-#endif
-
-#ifdef PLUGIN_112
-  Plugin_id[x] = 112;
-  Plugin_Description[x] = PLUGIN_DESC_112;
-  Plugin_ptr[x++] = &Plugin_112;
-#endif
-
-#ifdef PLUGIN_113
-  Plugin_id[x] = 113;
-  Plugin_Description[x] = PLUGIN_DESC_113;
-  Plugin_ptr[x++] = &Plugin_113;
-#endif
-
-#ifdef PLUGIN_114
-  Plugin_id[x] = 114;
-  Plugin_Description[x] = PLUGIN_DESC_114;
-  Plugin_ptr[x++] = &Plugin_114;
-#endif
-
-#ifdef PLUGIN_115
-  Plugin_id[x] = 115;
-  Plugin_Description[x] = PLUGIN_DESC_115;
-  Plugin_ptr[x++] = &Plugin_115;
-#endif
-
-#ifdef PLUGIN_116
-  Plugin_id[x] = 116;
-  Plugin_Description[x] = PLUGIN_DESC_116;
-  Plugin_ptr[x++] = &Plugin_116;
-#endif
-
-#ifdef PLUGIN_117
-  Plugin_id[x] = 117;
-  Plugin_Description[x] = PLUGIN_DESC_117;
-  Plugin_ptr[x++] = &Plugin_117;
-#endif
-
-#ifdef PLUGIN_118
-  Plugin_id[x] = 118;
-  Plugin_Description[x] = PLUGIN_DESC_118;
-  Plugin_ptr[x++] = &Plugin_118;
-#endif
-
-#ifdef PLUGIN_119
-  Plugin_id[x] = 119;
-  Plugin_Description[x] = PLUGIN_DESC_119;
-  Plugin_ptr[x++] = &Plugin_119;
-#endif
-
-#ifdef PLUGIN_120
-  Plugin_id[x] = 120;
-  Plugin_Description[x] = PLUGIN_DESC_120;
-  Plugin_ptr[x++] = &Plugin_120;
-#endif
-
-#ifdef PLUGIN_250
-  Plugin_id[x] = 250;
-  Plugin_Description[x] = PLUGIN_DESC_250;
-  Plugin_ptr[x++] = &Plugin_250;
-#endif
-
-#ifdef PLUGIN_251
-  Plugin_id[x] = 251;
-  Plugin_Description[x] = PLUGIN_DESC_251;
-  Plugin_ptr[x++] = &Plugin_251;
-#endif
-
-#ifdef PLUGIN_252
-  Plugin_id[x] = 252;
-  Plugin_Description[x] = PLUGIN_DESC_252;
-  Plugin_ptr[x++] = &Plugin_252;
-#endif
-
-#ifdef PLUGIN_253
-  Plugin_id[x] = 253;
-  Plugin_Description[x] = PLUGIN_DESC_253;
-  Plugin_ptr[x++] = &Plugin_253;
-#endif
-
-#ifdef PLUGIN_254
-  Plugin_id[x] = 254;
-  Plugin_Description[x] = PLUGIN_DESC_254;
-  Plugin_ptr[x++] = &Plugin_254;
-#endif
-
-#ifdef PLUGIN_255
-  Plugin_id[x] = 255;
-  Plugin_Description[x] = PLUGIN_DESC_255;
-  Plugin_ptr[x++] = &Plugin_255;
-#endif
-
-// read config file to desactivated protocols
-#ifdef AUTOCONNECT_ENABLED
-  LittleFS.begin();
-  Serial.print("Param ");
-  Serial.print(PROTOCOL_FILE);
-  Serial.print(F(" :\t"));
-  File configFile = LittleFS.open(PROTOCOL_FILE, "r");
-  if (configFile)
-  {
-    // const int capacity = JSON_ARRAY_SIZE(254) + 2 * JSON_OBJECT_SIZE(2); // 4128
-    // StaticJsonDocument<4128> doc;
-    DynamicJsonDocument doc(4128);
-
-    if (deserializeJson(doc, configFile))
-    {
-      Serial.println(F("Failed to load"));
-    }
-    else
-    {
-      for (x = 0; x < PLUGIN_MAX; x++)
-      {
-        if (doc[x][String(Plugin_id[x])] == 0)
-          Plugin_State[x] = P_Disabled;
-      }
-      Serial.println(F("Loaded"));
-    }
-    doc.clear();
-    configFile.close();
-  }
-  else
-  {
-    Serial.println(F("Failed to open(+r)"));
-  }
-  LittleFS.end();
-
-#endif // AUTOCONNECT_ENABLED
-
-  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
-  PluginInitCall(0, 0);
-}
-/*********************************************************************************************/
-void PluginTXInit(void)
-{
-  byte x;
-
-  // Wis de pointertabel voor de plugins.
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
-  {
-    PluginTX_ptr[x] = 0;
-    PluginTX_id[x] = 0;
-  }
-
-  x = 0;
-
-#ifdef PLUGIN_TX_001
-  PluginTX_id[x] = 1;
-  PluginTX_ptr[x++] = &PluginTX_001;
-#endif
-
-#ifdef PLUGIN_TX_002
-  PluginTX_id[x] = 2;
-  PluginTX_ptr[x++] = &PluginTX_002;
-#endif
-
-#ifdef PLUGIN_TX_003
-  PluginTX_id[x] = 3;
-  PluginTX_ptr[x++] = &PluginTX_003;
-#endif
-
-#ifdef PLUGIN_TX_004
-  PluginTX_id[x] = 4;
-  PluginTX_ptr[x++] = &PluginTX_004;
-#endif
-
-#ifdef PLUGIN_TX_005
-  PluginTX_id[x] = 5;
-  PluginTX_ptr[x++] = &PluginTX_005;
-#endif
-
-#ifdef PLUGIN_TX_006
-  PluginTX_id[x] = 6;
-  PluginTX_ptr[x++] = &PluginTX_006;
-#endif
-
-#ifdef PLUGIN_TX_007
-  PluginTX_id[x] = 7;
-  PluginTX_ptr[x++] = &PluginTX_007;
-#endif
-
-#ifdef PLUGIN_TX_008
-  PluginTX_id[x] = 8;
-  PluginTX_ptr[x++] = &PluginTX_008;
-#endif
-
-#ifdef PLUGIN_TX_009
-  PluginTX_id[x] = 9;
-  PluginTX_ptr[x++] = &PluginTX_009;
-#endif
-
-#ifdef PLUGIN_TX_010
-  PluginTX_id[x] = 10;
-  PluginTX_ptr[x++] = &PluginTX_010;
-#endif
-
-#ifdef PLUGIN_TX_011
-  PluginTX_id[x] = 11;
-  PluginTX_ptr[x++] = &PluginTX_011;
-#endif
-
-#ifdef PLUGIN_TX_012
-  PluginTX_id[x] = 12;
-  PluginTX_ptr[x++] = &PluginTX_012;
-#endif
-
-#ifdef PLUGIN_TX_013
-  PluginTX_id[x] = 13;
-  PluginTX_ptr[x++] = &PluginTX_013;
-#endif
-
-#ifdef PLUGIN_TX_014
-  PluginTX_id[x] = 14;
-  PluginTX_ptr[x++] = &PluginTX_014;
-#endif
-
-#ifdef PLUGIN_TX_015
-  PluginTX_id[x] = 15;
-  PluginTX_ptr[x++] = &PluginTX_015;
-#endif
-
-#ifdef PLUGIN_TX_016
-  PluginTX_id[x] = 16;
-  PluginTX_ptr[x++] = &PluginTX_016;
-#endif
-
-#ifdef PLUGIN_TX_017
-  PluginTX_id[x] = 17;
-  PluginTX_ptr[x++] = &PluginTX_017;
-#endif
-
-#ifdef PLUGIN_TX_018
-  PluginTX_id[x] = 18;
-  PluginTX_ptr[x++] = &PluginTX_018;
-#endif
-
-#ifdef PLUGIN_TX_019
-  PluginTX_id[x] = 19;
-  PluginTX_ptr[x++] = &PluginTX_019;
-#endif
-
-#ifdef PLUGIN_TX_020
-  PluginTX_id[x] = 20;
-  PluginTX_ptr[x++] = &PluginTX_020;
-#endif
-
-#ifdef PLUGIN_TX_021
-  PluginTX_id[x] = 21;
-  PluginTX_ptr[x++] = &PluginTX_021;
-#endif
-
-#ifdef PLUGIN_TX_022
-  PluginTX_id[x] = 22;
-  PluginTX_ptr[x++] = &PluginTX_022;
-#endif
-
-#ifdef PLUGIN_TX_023
-  PluginTX_id[x] = 23;
-  PluginTX_ptr[x++] = &PluginTX_023;
-#endif
-
-#ifdef PLUGIN_TX_024
-  PluginTX_id[x] = 24;
-  PluginTX_ptr[x++] = &PluginTX_024;
-#endif
-
-#ifdef PLUGIN_TX_025
-  PluginTX_id[x] = 25;
-  PluginTX_ptr[x++] = &PluginTX_025;
-#endif
-
-#ifdef PLUGIN_TX_026
-  PluginTX_id[x] = 26;
-  PluginTX_ptr[x++] = &PluginTX_026;
-#endif
-
-#ifdef PLUGIN_TX_027
-  PluginTX_id[x] = 27;
-  PluginTX_ptr[x++] = &PluginTX_027;
-#endif
-
-#ifdef PLUGIN_TX_028
-  PluginTX_id[x] = 28;
-  PluginTX_ptr[x++] = &PluginTX_028;
-#endif
-
-#ifdef PLUGIN_TX_029
-  PluginTX_id[x] = 29;
-  PluginTX_ptr[x++] = &PluginTX_029;
-#endif
-
-#ifdef PLUGIN_TX_030
-  PluginTX_id[x] = 30;
-  PluginTX_ptr[x++] = &PluginTX_030;
-#endif
-
-#ifdef PLUGIN_TX_031
-  PluginTX_id[x] = 31;
-  PluginTX_ptr[x++] = &PluginTX_031;
-#endif
-
-#ifdef PLUGIN_TX_032
-  PluginTX_id[x] = 32;
-  PluginTX_ptr[x++] = &PluginTX_032;
-#endif
-
-#ifdef PLUGIN_TX_033
-  PluginTX_id[x] = 33;
-  PluginTX_ptr[x++] = &PluginTX_033;
-#endif
-
-#ifdef PLUGIN_TX_034
-  PluginTX_id[x] = 34;
-  PluginTX_ptr[x++] = &PluginTX_034;
-#endif
-
-#ifdef PLUGIN_TX_035
-  PluginTX_id[x] = 35;
-  PluginTX_ptr[x++] = &PluginTX_035;
-#endif
-
-#ifdef PLUGIN_TX_036
-  PluginTX_id[x] = 36;
-  PluginTX_ptr[x++] = &PluginTX_036;
-#endif
-
-#ifdef PLUGIN_TX_037
-  PluginTX_id[x] = 37;
-  PluginTX_ptr[x++] = &PluginTX_037;
-#endif
-
-#ifdef PLUGIN_TX_038
-  PluginTX_id[x] = 38;
-  PluginTX_ptr[x++] = &PluginTX_038;
-#endif
-
-#ifdef PLUGIN_TX_039
-  PluginTX_id[x] = 39;
-  PluginTX_ptr[x++] = &PluginTX_039;
-#endif
-
-#ifdef PLUGIN_TX_040
-  PluginTX_id[x] = 40;
-  PluginTX_ptr[x++] = &PluginTX_040;
-#endif
-
-#ifdef PLUGIN_TX_041
-  PluginTX_id[x] = 41;
-  PluginTX_ptr[x++] = &PluginTX_041;
-#endif
-
-#ifdef PLUGIN_TX_042
-  PluginTX_id[x] = 42;
-  PluginTX_ptr[x++] = &PluginTX_042;
-#endif
-
-#ifdef PLUGIN_TX_043
-  PluginTX_id[x] = 43;
-  PluginTX_ptr[x++] = &PluginTX_043;
-#endif
-
-#ifdef PLUGIN_TX_044
-  PluginTX_id[x] = 44;
-  PluginTX_ptr[x++] = &PluginTX_044;
-#endif
-
-#ifdef PLUGIN_TX_045
-  PluginTX_id[x] = 45;
-  PluginTX_ptr[x++] = &PluginTX_045;
-#endif
-
-#ifdef PLUGIN_TX_046
-  PluginTX_id[x] = 46;
-  PluginTX_ptr[x++] = &PluginTX_046;
-#endif
-
-#ifdef PLUGIN_TX_047
-  PluginTX_id[x] = 47;
-  PluginTX_ptr[x++] = &PluginTX_047;
-#endif
-
-#ifdef PLUGIN_TX_048
-  PluginTX_id[x] = 48;
-  PluginTX_ptr[x++] = &PluginTX_048;
-#endif
-
-#ifdef PLUGIN_TX_049
-  PluginTX_id[x] = 49;
-  PluginTX_ptr[x++] = &PluginTX_049;
-#endif
+#include "5_Repeat.h"
+#include "7_Utils.h"
+#ifdef ESP8266
+#include <FS.h>
+#include <LittleFS.h>
+#elif ESP32
+#include <SPIFFS.h>
+#define LittleFS SPIFFS
+#else
+#include <EEPROM.h>
+#endif // ESP8266
+#ifdef AUTOCONNECT_ENABLED
+#include "9_AutoConnect.h"
+#include <ArduinoJson.h>
+#endif // AUTOCONNECT
 
-#ifdef PLUGIN_TX_050
-  PluginTX_id[x] = 50;
-  PluginTX_ptr[x++] = &PluginTX_050;
-#endif
+boolean RFDebug = RFDebug_0;     // debug RF signals with plugin 001 (no decode)
+boolean QRFDebug = QRFDebug_0;   // debug RF signals with plugin 001 but no multiplication (faster?, compact)
+boolean RFUDebug = RFUDebug_0;   // debug RF signals with plugin 254 (decode 1st)
+boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
-#ifdef PLUGIN_TX_051
-  PluginTX_id[x] = 51;
-  PluginTX_ptr[x++] = &PluginTX_051;
-#endif
 
-#ifdef PLUGIN_TX_052
-  PluginTX_id[x] = 52;
-  PluginTX_ptr[x++] = &PluginTX_052;
-#endif
+/**********************************************************************************************\
+ * Load plugins
+\*********************************************************************************************/
+#include "./Plugins/_Plugin_Config_01.h"
 
-#ifdef PLUGIN_TX_053
-  PluginTX_id[x] = 53;
-  PluginTX_ptr[x++] = &PluginTX_053;
-#endif
+// Sources of the plugins built in, see _Plugin_List.h. Later passes over the list only build tables.
+#define PLUGIN_STRING_(s) #s
+#define PLUGIN_STRING(s) PLUGIN_STRING_(s)
+#define PLUGIN_SOURCE(n) PLUGIN_STRING(Plugin_##n.c)
+#define PLUGIN(n, flags)
+#include "./Plugins/_Plugin_List.h"
+#undef PLUGIN
+#undef PLUGIN_SOURCE
+#define PLUGIN_SOURCE(n) "_Plugin_None.h"
 
-#ifdef PLUGIN_TX_054
-  PluginTX_id[x] = 54;
-  PluginTX_ptr[x++] = &PluginTX_054;
-#endif
+/*********************************************************************************************\
+ * Packet lengths the enabled plugins decode, as a bitmap built at compile time,
+ * and on ESP as the per length dispatch index built by PluginInit().
+ * Each plugin gives them as PLUGIN_PULSES_xxx, {min, max} ranges next to its PLUGIN_DESC_xxx
+ * and the pulse count check they mirror. Debug plugins 001 and 254 show any length, so they
+ * give none.
+\*********************************************************************************************/
+#define PLUGIN_PULSE_RANGES 4 // Most ranges one plugin gives
 
-#ifdef PLUGIN_TX_055
-  PluginTX_id[x] = 55;
-  PluginTX_ptr[x++] = &PluginTX_055;
-#endif
+struct PulseRange
+{
+  int Min;
+  int Max; // 0: unused
+};
 
-#ifdef PLUGIN_TX_056
-  PluginTX_id[x] = 56;
-  PluginTX_ptr[x++] = &PluginTX_056;
-#endif
+struct PluginPulses
+{
+  byte Plugin; // Plugin number, as in Plugin_Table[]
+  PulseRange Ranges[PLUGIN_PULSE_RANGES];
+};
+
+static constexpr PluginPulses Plugin_Pulses[] = {
+    {0, {}}, // Empty, keeps the table valid when no plugin is enabled
+#define PLUGIN(n, flags) {PLUGIN_ID(n), {PLUGIN_PULSES_##n}},
+#include "./Plugins/_Plugin_List.h"
+#undef PLUGIN
+};
+
+#define PLUGIN_PULSES_COUNT (sizeof(Plugin_Pulses) / sizeof(Plugin_Pulses[0]))
+#define PLUGIN_RANGES_COUNT (PLUGIN_PULSES_COUNT * PLUGIN_PULSE_RANGES)
+#define PLUGIN_PULSES_WORDS ((RAW_BUFFER_SIZE + 32) / 32) // One bit per length, 0..RAW_BUFFER_SIZE
+
+// Ranges of all plugins, one after the other
+static constexpr PulseRange Plugin_Range(unsigned int i)
+{
+  return Plugin_Pulses[i / PLUGIN_PULSE_RANGES].Ranges[i % PLUGIN_PULSE_RANGES];
+}
 
-#ifdef PLUGIN_TX_057
-  PluginTX_id[x] = 57;
-  PluginTX_ptr[x++] = &PluginTX_057;
-#endif
+static constexpr boolean Plugin_PulsesBit(int pulses, unsigned int i = 0)
+{
+  return (i < PLUGIN_RANGES_COUNT) &&
+         ((Plugin_Range(i).Max && (pulses >= Plugin_Range(i).Min) && (pulses <= Plugin_Range(i).Max)) || Plugin_PulsesBit(pulses, i + 1));
+}
 
-#ifdef PLUGIN_TX_058
-  PluginTX_id[x] = 58;
-  PluginTX_ptr[x++] = &PluginTX_058;
-#endif
+static constexpr uint32_t Plugin_PulsesWord(int word, int bit = 0)
+{
+  return (bit == 32) ? 0UL : ((Plugin_PulsesBit(word * 32 + bit) ? (1UL << bit) : 0UL) | Plugin_PulsesWord(word, bit + 1));
+}
 
-#ifdef PLUGIN_TX_059
-  PluginTX_id[x] = 59;
-  PluginTX_ptr[x++] = &PluginTX_059;
-#endif
+static constexpr int Plugin_PulsesMin(unsigned int i = 0, int min = RAW_BUFFER_SIZE + 1)
+{
+  return (i == PLUGIN_RANGES_COUNT) ? min : Plugin_PulsesMin(i + 1, (Plugin_Range(i).Max && (Plugin_Range(i).Min < min)) ? Plugin_Range(i).Min : min);
+}
 
-#ifdef PLUGIN_TX_060
-  PluginTX_id[x] = 60;
-  PluginTX_ptr[x++] = &PluginTX_060;
-#endif
+static constexpr boolean Plugin_PulsesValid(unsigned int i = 0)
+{
+  return (i == PLUGIN_RANGES_COUNT) || ((!Plugin_Range(i).Max || (Plugin_Range(i).Min <= Plugin_Range(i).Max)) && (Plugin_Range(i).Max <= RAW_BUFFER_SIZE) && Plugin_PulsesValid(i + 1));
+}
 
-#ifdef PLUGIN_TX_061
-  PluginTX_id[x] = 61;
-  PluginTX_ptr[x++] = &PluginTX_061;
-#endif
+static constexpr uint32_t Plugin_PulsesMap[] = {
+    Plugin_PulsesWord(0), Plugin_PulsesWord(1), Plugin_PulsesWord(2), Plugin_PulsesWord(3), Plugin_PulsesWord(4),
+    Plugin_PulsesWord(5), Plugin_PulsesWord(6), Plugin_PulsesWord(7), Plugin_PulsesWord(8), Plugin_PulsesWord(9)};
 
-#ifdef PLUGIN_TX_062
-  PluginTX_id[x] = 62;
-  PluginTX_ptr[x++] = &PluginTX_062;
+static_assert(sizeof(Plugin_PulsesMap) / sizeof(Plugin_PulsesMap[0]) == PLUGIN_PULSES_WORDS, "Plugin_PulsesMap[] size must follow RAW_BUFFER_SIZE");
+static_assert(Plugin_PulsesValid(), "A PLUGIN_PULSES_xxx range is empty or longer than RAW_BUFFER_SIZE");
+#ifndef __AVR__ // AVR keeps MIN_RAW_PULSES at 50: shorter packets never reach the plugins there, as before
+static_assert(Plugin_PulsesMin() >= MIN_RAW_PULSES - 1, "An enabled plugin decodes packets shorter than MIN_RAW_PULSES, lower it");
 #endif
 
-#ifdef PLUGIN_TX_063
-  PluginTX_id[x] = 63;
-  PluginTX_ptr[x++] = &PluginTX_063;
-#endif
+/*********************************************************************************************\
+ * Plugin descriptors, in flash. One per enabled plugin, in the order they are tried.
+ * The slot of a plugin is its index in this table.
+\*********************************************************************************************/
+// Shortest and longest packet of a plugin, over its PLUGIN_PULSES_xxx ranges. Min > Max when it has none.
+static constexpr int Plugin_PulsesLow(byte id, unsigned int i = PLUGIN_PULSE_RANGES, int low = RAW_BUFFER_SIZE + 1)
+{
+  return (i == PLUGIN_RANGES_COUNT) ? low : Plugin_PulsesLow(id, i + 1, ((Plugin_Pulses[i / PLUGIN_PULSE_RANGES].Plugin == id) && Plugin_Range(i).Max && (Plugin_Range(i).Min < low)) ? Plugin_Range(i).Min : low);
+}
 
-#ifdef PLUGIN_TX_064
-  PluginTX_id[x] = 64;
-  PluginTX_ptr[x++] = &PluginTX_064;
-#endif
+static constexpr int Plugin_PulsesHigh(byte id, unsigned int i = PLUGIN_PULSE_RANGES, int high = 0)
+{
+  return (i == PLUGIN_RANGES_COUNT) ? high : Plugin_PulsesHigh(id, i + 1, ((Plugin_Pulses[i / PLUGIN_PULSE_RANGES].Plugin == id) && (Plugin_Range(i).Max > high)) ? Plugin_Range(i).Max : high);
+}
 
-#ifdef PLUGIN_TX_065
-  PluginTX_id[x] = 65;
-  PluginTX_ptr[x++] = &PluginTX_065;
-#endif
+/*********************************************************************************************\
+ * Marks and spaces the plugins decode, checked by PluginRXTry() against the features of the
+ * packet in PulseClass, so that noise is refused without calling them.
+ * Each entry must hold every pulse the plugin accepts, keep them in sync with its checks.
+ * Plugins with no entry are called for any packet of their length.
+\*********************************************************************************************/
+struct PulseShape
+{
+  byte Plugin; // Plugin number, as in Plugin_Table[]
+  PluginShape Shape;
+};
 
-#ifdef PLUGIN_TX_066
-  PluginTX_id[x] = 66;
-  PluginTX_ptr[x++] = &PluginTX_066;
+static constexpr PulseShape Plugin_Shapes[] = {
+    {0, {0, 0xFF, 0, 0xFF}}, // Empty, keeps the table valid when no plugin is enabled
+#ifdef PLUGIN_040
+    {40, {MEBUS_MARK_MIN / RAWSIGNAL_SAMPLE_RATE, MEBUS_MARK_MAX / RAWSIGNAL_SAMPLE_RATE, MEBUS_ZERO_MIN / RAWSIGNAL_SAMPLE_RATE, MEBUS_ONE_MAX / RAWSIGNAL_SAMPLE_RATE}},
 #endif
-
-#ifdef PLUGIN_TX_067
-  PluginTX_id[x] = 67;
-  PluginTX_ptr[x++] = &PluginTX_067;
+#ifdef PLUGIN_046
+    {46, {AURIOLV2_MARK_MIN / RAWSIGNAL_SAMPLE_RATE, AURIOLV2_MARK_MAX / RAWSIGNAL_SAMPLE_RATE, AURIOLV2_ZERO_MIN / RAWSIGNAL_SAMPLE_RATE, AURIOLV2_ONE_MAX / RAWSIGNAL_SAMPLE_RATE}},
 #endif
-
-#ifdef PLUGIN_TX_068
-  PluginTX_id[x] = 68;
-  PluginTX_ptr[x++] = &PluginTX_068;
+#ifdef PLUGIN_070
+    {70, {0, 0xFF, 0, SELECTPLUS_PULSEMAX}},
 #endif
-
-#ifdef PLUGIN_TX_069
-  PluginTX_id[x] = 69;
-  PluginTX_ptr[x++] = &PluginTX_069;
+#ifdef PLUGIN_071
+    {71, {0, 0xFF, 0, (PLIEGER_LONG + PLIEGER_TOLERANCE) / RAWSIGNAL_SAMPLE_RATE}},
 #endif
-
-#ifdef PLUGIN_TX_070
-  PluginTX_id[x] = 70;
-  PluginTX_ptr[x++] = &PluginTX_070;
+#ifdef PLUGIN_073
+    {73, {0, 0xFF, DELTRONIC_SPACE_MIN / RAWSIGNAL_SAMPLE_RATE, DELTRONIC_SPACE_MAX / RAWSIGNAL_SAMPLE_RATE}},
 #endif
+};
 
-#ifdef PLUGIN_TX_071
-  PluginTX_id[x] = 71;
-  PluginTX_ptr[x++] = &PluginTX_071;
-#endif
+#define PLUGIN_SHAPES_COUNT (sizeof(Plugin_Shapes) / sizeof(Plugin_Shapes[0]))
 
-#ifdef PLUGIN_TX_072
-  PluginTX_id[x] = 72;
-  PluginTX_ptr[x++] = &PluginTX_072;
-#endif
+static constexpr PluginShape Plugin_ShapeOf(byte id, unsigned int r = 1)
+{
+  return (r == PLUGIN_SHAPES_COUNT) ? Plugin_Shapes[0].Shape : (Plugin_Shapes[r].Plugin == id) ? Plugin_Shapes[r].Shape : Plugin_ShapeOf(id, r + 1);
+}
 
-#ifdef PLUGIN_TX_073
-  PluginTX_id[x] = 73;
-  PluginTX_ptr[x++] = &PluginTX_073;
-#endif
+#define PLUGIN_DESCRIPTOR(n, flags, tx)                                                   \
+  {                                                                                       \
+    PLUGIN_ID(n), flags,                                                                  \
+        ((flags)&PLUGIN_ANY_LENGTH) ? 0 : Plugin_PulsesLow(PLUGIN_ID(n)),                 \
+        ((flags)&PLUGIN_ANY_LENGTH) ? RAW_BUFFER_SIZE : Plugin_PulsesHigh(PLUGIN_ID(n)), \
+        Plugin_ShapeOf(PLUGIN_ID(n)), &Plugin_##n, tx, PLUGIN_DESC_##n                    \
+  }
 
-#ifdef PLUGIN_TX_074
-  PluginTX_id[x] = 74;
-  PluginTX_ptr[x++] = &PluginTX_074;
-#endif
+// &PluginTX_xxx when PLUGIN_TX_xxx is defined, empty as in _Plugin_Config_01.h, NULL otherwise
+#define PLUGIN_PROBE_ ~, 1
+#define PLUGIN_SECOND(a, b, ...) b
+#define PLUGIN_PROBE(x) PLUGIN_SECOND(x, 0, ~)
+#define PLUGIN_DEFINED_(value) PLUGIN_PROBE(PLUGIN_PROBE_##value)
+#define PLUGIN_DEFINED(name) PLUGIN_DEFINED_(name)
+#define PLUGIN_SELECT_0(yes, no) no
+#define PLUGIN_SELECT_1(yes, no) yes
+#define PLUGIN_SELECT_(flag) PLUGIN_SELECT_##flag
+#define PLUGIN_SELECT(flag) PLUGIN_SELECT_(flag)
+#define PLUGIN_TX_FUNCTION(n) PLUGIN_SELECT(PLUGIN_DEFINED(PLUGIN_TX_##n))(&PluginTX_##n, NULL)
+
+constexpr PluginDescriptor Plugin_Table[] PROGMEM = {
+#define PLUGIN(n, flags) PLUGIN_DESCRIPTOR(n, flags, PLUGIN_TX_FUNCTION(n)),
+#include "./Plugins/_Plugin_List.h"
+#undef PLUGIN
+};
+
+#define PLUGIN_COUNT (sizeof(Plugin_Table) / sizeof(Plugin_Table[0]))
+const byte Plugin_Count = PLUGIN_COUNT;
+uint32_t Plugin_Enabled[(PLUGIN_COUNT + 31) / 32];
+
+static constexpr boolean Plugin_TableRanged(unsigned int x = 0)
+{
+  return (x == PLUGIN_COUNT) || (((Plugin_Table[x].Flags & PLUGIN_ANY_LENGTH) || (Plugin_Table[x].Min <= Plugin_Table[x].Max)) && Plugin_TableRanged(x + 1));
+}
 
-#ifdef PLUGIN_TX_075
-  PluginTX_id[x] = 75;
-  PluginTX_ptr[x++] = &PluginTX_075;
-#endif
+static_assert(PLUGIN_COUNT < 255, "Plugin slots must fit in a byte");
+static_assert(Plugin_TableRanged(), "An enabled plugin has no PLUGIN_PULSES_xxx range, nor PLUGIN_ANY_LENGTH");
 
-#ifdef PLUGIN_TX_076
-  PluginTX_id[x] = 76;
-  PluginTX_ptr[x++] = &PluginTX_076;
-#endif
+void Plugin_Enable(byte x, boolean enabled)
+{
+  if (enabled)
+    Plugin_Enabled[x >> 5] |= (1UL << (x & 31));
+  else
+    Plugin_Enabled[x >> 5] &= ~(1UL << (x & 31));
+}
 
-#ifdef PLUGIN_TX_077
-  PluginTX_id[x] = 77;
-  PluginTX_ptr[x++] = &PluginTX_077;
-#endif
+byte Plugin_Slot(byte id)
+{
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    if (Plugin_Id(x) == id)
+      return x;
+  return PLUGIN_COUNT;
+}
 
-#ifdef PLUGIN_TX_078
-  PluginTX_id[x] = 78;
-  PluginTX_ptr[x++] = &PluginTX_078;
-#endif
+/*********************************************************************************************\
+ * Plugins turned off, kept in flash: PLUGIN_STATE_FILE on ESP, the EEPROM on AVR.
+ * One bit per plugin number rather than per slot, so that it still holds after plugins are
+ * added to or removed from the build. Plugins without their bit set are on.
+\*********************************************************************************************/
+#define PLUGIN_STATE_VERSION 1
 
-#ifdef PLUGIN_TX_079
-  PluginTX_id[x] = 79;
-  PluginTX_ptr[x++] = &PluginTX_079;
-#endif
+struct PluginStateStruct
+{
+  byte Version;  // PLUGIN_STATE_VERSION
+  byte Off[32];  // Bit id & 7 of Off[id >> 3]: plugin id turned off
+  uint16_t CRC;  // crc16() of the fields above
+};
 
-#ifdef PLUGIN_TX_080
-  PluginTX_id[x] = 80;
-  PluginTX_ptr[x++] = &PluginTX_080;
-#endif
+static uint16_t PluginStateCRC(const PluginStateStruct *state)
+{
+  return crc16((const uint8_t *)state, offsetof(PluginStateStruct, CRC), 0x1021, 0xFFFF);
+}
 
-#ifdef PLUGIN_TX_081
-  PluginTX_id[x] = 81;
-  PluginTX_ptr[x++] = &PluginTX_081;
+#if (defined(ESP32) || defined(ESP8266))
+static boolean PluginStateMount()
+{
+#ifdef ESP32
+  return LittleFS.begin(true); // Formats on the first use
+#else
+  return LittleFS.begin();
 #endif
-
-#ifdef PLUGIN_TX_082
-  PluginTX_id[x] = 82;
-  PluginTX_ptr[x++] = &PluginTX_082;
+}
 #endif
 
-#ifdef PLUGIN_TX_083
-  PluginTX_id[x] = 83;
-  PluginTX_ptr[x++] = &PluginTX_083;
-#endif
+boolean PluginStateLoad()
+{
+  PluginStateStruct state;
+  boolean loaded = false;
 
-#ifdef PLUGIN_TX_084
-  PluginTX_id[x] = 84;
-  PluginTX_ptr[x++] = &PluginTX_084;
-#endif
+#if (defined(ESP32) || defined(ESP8266))
+  if (PluginStateMount())
+  {
+    File file = LittleFS.open(PLUGIN_STATE_FILE, "r");
 
-#ifdef PLUGIN_TX_085
-  PluginTX_id[x] = 85;
-  PluginTX_ptr[x++] = &PluginTX_085;
+    if (file)
+    {
+      loaded = (file.read((uint8_t *)&state, sizeof(state)) == sizeof(state));
+      file.close();
+    }
+    LittleFS.end();
+  }
+#else
+  EEPROM.get(PLUGIN_STATE_EEPROM, state);
+  loaded = true;
 #endif
+  if (!loaded || (state.Version != PLUGIN_STATE_VERSION) || (state.CRC != PluginStateCRC(&state)))
+    return false;
 
-#ifdef PLUGIN_TX_086
-  PluginTX_id[x] = 86;
-  PluginTX_ptr[x++] = &PluginTX_086;
-#endif
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+  {
+    byte id = Plugin_Id(x);
 
-#ifdef PLUGIN_TX_087
-  PluginTX_id[x] = 87;
-  PluginTX_ptr[x++] = &PluginTX_087;
-#endif
+    Plugin_Enable(x, !((state.Off[id >> 3] >> (id & 7)) & 1));
+  }
+  return true;
+}
 
-#ifdef PLUGIN_TX_088
-  PluginTX_id[x] = 88;
-  PluginTX_ptr[x++] = &PluginTX_088;
-#endif
+boolean PluginStateSave()
+{
+  PluginStateStruct state;
+  boolean saved = false;
+
+  memset(&state, 0, sizeof(state));
+  state.Version = PLUGIN_STATE_VERSION;
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    if (!Plugin_IsEnabled(x))
+      state.Off[Plugin_Id(x) >> 3] |= 1 << (Plugin_Id(x) & 7);
+  state.CRC = PluginStateCRC(&state);
+
+#if (defined(ESP32) || defined(ESP8266))
+  if (PluginStateMount())
+  {
+    File file = LittleFS.open(PLUGIN_STATE_FILE, "w");
 
-#ifdef PLUGIN_TX_089
-  PluginTX_id[x] = 89;
-  PluginTX_ptr[x++] = &PluginTX_089;
+    if (file)
+    {
+      saved = (file.write((const uint8_t *)&state, sizeof(state)) == sizeof(state));
+      file.close();
+    }
+    LittleFS.end();
+  }
+#else
+  EEPROM.put(PLUGIN_STATE_EEPROM, state); // Only writes the bytes that changed
+  saved = true;
 #endif
+  return saved;
+}
 
-#ifdef PLUGIN_TX_090
-  PluginTX_id[x] = 90;
-  PluginTX_ptr[x++] = &PluginTX_090;
-#endif
+#ifdef AUTOCONNECT_ENABLED
+// PROTOCOL_FILE written by the web page of earlier versions
+static boolean PluginStateImport()
+{
+  boolean imported = false;
 
-#ifdef PLUGIN_TX_091
-  PluginTX_id[x] = 91;
-  PluginTX_ptr[x++] = &PluginTX_091;
-#endif
+  if (!PluginStateMount())
+    return false;
+  File configFile = LittleFS.open(PROTOCOL_FILE, "r");
+  if (configFile)
+  {
+    // const int capacity = JSON_ARRAY_SIZE(254) + 2 * JSON_OBJECT_SIZE(2); // 4128
+    DynamicJsonDocument doc(4128);
 
-#ifdef PLUGIN_TX_092
-  PluginTX_id[x] = 92;
-  PluginTX_ptr[x++] = &PluginTX_092;
-#endif
+    if (!deserializeJson(doc, configFile))
+    {
+      for (byte x = 0; x < PLUGIN_COUNT; x++)
+      {
+        if (doc[x][String(Plugin_Id(x))] == 0)
+          Plugin_Enable(x, false);
+      }
+      imported = true;
+    }
+    doc.clear();
+    configFile.close();
+  }
+  LittleFS.end();
+  return imported;
+}
+#endif // AUTOCONNECT_ENABLED
 
-#ifdef PLUGIN_TX_093
-  PluginTX_id[x] = 93;
-  PluginTX_ptr[x++] = &PluginTX_093;
-#endif
+#if (defined(ESP32) || defined(ESP8266))
+// Entries of all ranges, more than the index will hold
+static constexpr unsigned int Plugin_PulsesSpan(unsigned int i = 0, unsigned int span = 0)
+{
+  return (i == PLUGIN_RANGES_COUNT) ? span : Plugin_PulsesSpan(i + 1, span + (!Plugin_Range(i).Max ? 0 : (Plugin_Range(i).Max - (Plugin_Range(i).Min < 0 ? 0 : Plugin_Range(i).Min) + 1)));
+}
 
-#ifdef PLUGIN_TX_094
-  PluginTX_id[x] = 94;
-  PluginTX_ptr[x++] = &PluginTX_094;
-#endif
+// Slots of the plugins that accept packets of each length, in Plugin_Table[] order until reordered by hits:
+// Plugin_Index[Plugin_IndexStart[n]..Plugin_IndexStart[n + 1] - 1] for a packet of n pulses.
+// PLUGIN_ANY_LENGTH plugins (001, 254) are in Plugin_Always[] and called whatever the length.
+static byte Plugin_Index[Plugin_PulsesSpan() + 1];
+static uint16_t Plugin_IndexStart[RAW_BUFFER_SIZE + 2];
+static byte Plugin_Always[PLUGIN_COUNT];
+static byte Plugin_AlwaysCount;
+static byte Plugin_IndexFirst; // First slot with a range, plugins before it are a pre-pass that may change the packet, those after it a fallback
+
+unsigned int Plugin_Hits[PLUGIN_COUNT]; // Decodes per slot, halved at each reordering so recent traffic counts most
+static byte Plugin_Decodes;           // Decodes since the last reordering
+
+// Plugins never swapped in a list, the first one mutes itself after the second one decoded (Repeat_Recent())
+static const byte Plugin_Pinned[][2] = {
+    {3, 12},  // Kaku ignores packets for 2 seconds after FA500
+    {4, 12},  // NewKaku ignores packets for 2 seconds after FA500
+    {3, 15}}; // Kaku ignores packets for 2 seconds after HomeEasy
+
+static boolean Plugin_IsPinned(byte x, byte y)
+{
+  for (byte p = 0; p < sizeof(Plugin_Pinned) / sizeof(Plugin_Pinned[0]); p++)
+    if (((Plugin_Id(x) == Plugin_Pinned[p][0]) && (Plugin_Id(y) == Plugin_Pinned[p][1])) ||
+        ((Plugin_Id(x) == Plugin_Pinned[p][1]) && (Plugin_Id(y) == Plugin_Pinned[p][0])))
+      return true;
+  return false;
+}
 
-#ifdef PLUGIN_TX_095
-  PluginTX_id[x] = 95;
-  PluginTX_ptr[x++] = &PluginTX_095;
-#endif
+// Most decoding plugins first in each list, ties and pinned pairs keep their order
+static void PluginRXReorder()
+{
+  for (int n = 0; n <= RAW_BUFFER_SIZE; n++)
+  {
+    byte *list = &Plugin_Index[Plugin_IndexStart[n]];
+    int count = Plugin_IndexStart[n + 1] - Plugin_IndexStart[n];
 
-#ifdef PLUGIN_TX_096
-  PluginTX_id[x] = 96;
-  PluginTX_ptr[x++] = &PluginTX_096;
-#endif
+    for (int i = 1; i < count; i++)
+      for (int j = i; (j > 0) && (Plugin_Hits[list[j]] > Plugin_Hits[list[j - 1]]) && !Plugin_IsPinned(list[j - 1], list[j]); j--)
+      {
+        byte x = list[j];
+        list[j] = list[j - 1];
+        list[j - 1] = x;
+      }
+  }
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    Plugin_Hits[x] >>= 1;
+  Plugin_Decodes = 0;
+}
 
-#ifdef PLUGIN_TX_097
-  PluginTX_id[x] = 97;
-  PluginTX_ptr[x++] = &PluginTX_097;
-#endif
+static boolean Plugin_Ranged(byte x, int pulses)
+{
+  byte id = Plugin_Id(x);
 
-#ifdef PLUGIN_TX_098
-  PluginTX_id[x] = 98;
-  PluginTX_ptr[x++] = &PluginTX_098;
-#endif
+  if ((pulses < Plugin_Min(x)) || (pulses > Plugin_Max(x)))
+    return false;
+  for (unsigned int r = 1; r < PLUGIN_PULSES_COUNT; r++)
+    if (Plugin_Pulses[r].Plugin == id)
+      for (byte k = 0; k < PLUGIN_PULSE_RANGES; k++)
+      {
+        const PulseRange *range = &Plugin_Pulses[r].Ranges[k];
 
-#ifdef PLUGIN_TX_099
-  PluginTX_id[x] = 99;
-  PluginTX_ptr[x++] = &PluginTX_099;
-#endif
+        if (range->Max && (pulses >= range->Min) && (pulses <= range->Max))
+          return true;
+      }
+  return false;
+}
 
-#ifdef PLUGIN_TX_100
-  PluginTX_id[x] = 100;
-  PluginTX_ptr[x++] = &PluginTX_100;
-#endif
+static void PluginRXIndex()
+{
+  uint16_t count = 0;
+
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    Plugin_Hits[x] = 0;
+  Plugin_Decodes = 0;
+  Plugin_AlwaysCount = 0;
+  Plugin_IndexFirst = PLUGIN_COUNT;
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+  {
+    if (Plugin_Flags(x) & PLUGIN_ANY_LENGTH)
+      Plugin_Always[Plugin_AlwaysCount++] = x;
+    else if (Plugin_IndexFirst == PLUGIN_COUNT)
+      Plugin_IndexFirst = x;
+  }
 
-#ifdef PLUGIN_TX_250
-  PluginTX_id[x] = 250;
-  PluginTX_ptr[x++] = &PluginTX_250;
-#endif
+  // Length by length, so each list keeps the plugins order
+  for (int n = 0; n <= RAW_BUFFER_SIZE; n++)
+  {
+    Plugin_IndexStart[n] = count;
+    for (byte x = Plugin_IndexFirst; x < PLUGIN_COUNT; x++)
+      if (!(Plugin_Flags(x) & PLUGIN_ANY_LENGTH) && Plugin_Ranged(x, n))
+        Plugin_Index[count++] = x;
+  }
+  Plugin_IndexStart[RAW_BUFFER_SIZE + 1] = count;
+}
 
-#ifdef PLUGIN_TX_251
-  PluginTX_id[x] = 251;
-  PluginTX_ptr[x++] = &PluginTX_251;
-#endif
+// Pre-pass plugins, those indexed for the length in their current order, then the fallback ones, as PluginRXCall()
+byte PluginRXOrder(int pulses, byte i)
+{
+  byte pre = 0;
+  uint16_t indexed = 0;
+
+  while ((pre < Plugin_AlwaysCount) && (Plugin_Always[pre] < Plugin_IndexFirst))
+    pre++;
+  if (i < pre)
+    return Plugin_Always[i];
+  i -= pre;
+  if ((pulses >= 0) && (pulses <= RAW_BUFFER_SIZE))
+    indexed = Plugin_IndexStart[pulses + 1] - Plugin_IndexStart[pulses];
+  if (i < indexed)
+    return Plugin_Index[Plugin_IndexStart[pulses] + i];
+  i -= indexed;
+  if (pre + i < Plugin_AlwaysCount)
+    return Plugin_Always[pre + i];
+  return PLUGIN_COUNT;
+}
 
-#ifdef PLUGIN_TX_252
-  PluginTX_id[x] = 252;
-  PluginTX_ptr[x++] = &PluginTX_252;
+// Back to the plugins order, forgetting the hits
+void PluginRXOrderReset()
+{
+  PluginRXIndex();
+}
 #endif
+/*********************************************************************************************/
+void PluginInit(void)
+{
+  byte x;
 
-#ifdef PLUGIN_TX_253
-  PluginTX_id[x] = 253;
-  PluginTX_ptr[x++] = &PluginTX_253;
-#endif
+  for (x = 0; x < PLUGIN_COUNT; x++)
+    Plugin_Enable(x, true);
 
-#ifdef PLUGIN_TX_254
-  PluginTX_id[x] = 254;
-  PluginTX_ptr[x++] = &PluginTX_254;
+  // Plugins turned off, from earlier 10;PLUGIN=<id>;OFF; or the web page
+#if (defined(ESP32) || defined(ESP8266))
+  Serial.print(F("Param "));
+  Serial.print(F(PLUGIN_STATE_FILE));
+  Serial.print(F(" :\t"));
+  if (PluginStateLoad())
+    Serial.println(F("Loaded"));
+#ifdef AUTOCONNECT_ENABLED
+  else if (PluginStateImport())
+    Serial.println(PluginStateSave() ? F("Imported") : F("Failed to save(+w)"));
+#endif // AUTOCONNECT_ENABLED
+  else
+    Serial.println(F("None, all plugins on"));
+#else
+  PluginStateLoad();
 #endif
 
-#ifdef PLUGIN_TX_255
-  PluginTX_id[x] = 255;
-  PluginTX_ptr[x++] = &PluginTX_255;
+#if (defined(ESP32) || defined(ESP8266))
+  PluginRXIndex();
+  PluginStatsReset();
 #endif
 
+  // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
+  PluginInitCall(0, 0);
+}
+/*********************************************************************************************/
+void PluginTXInit(void)
+{
   // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGINTX_INIT
   PluginTXInitCall(0, 0);
 }
@@ -1907,15 +523,8 @@ void PluginTXInit(void)
  \*********************************************************************************************/
 byte PluginInitCall(byte Function, char *str)
 {
-  int x;
-
-  for (x = 0; x < PLUGIN_MAX; x++)
-  {
-    if (Plugin_id[x] != 0)
-    {
-      Plugin_ptr[x](Function, str);
-    }
-  }
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    Plugin_RX(x)(Function, &RawSignal); // Nothing captured yet, RawSignal.Number is 0
   return true;
 }
 /*********************************************************************************************\
@@ -1923,55 +532,168 @@ byte PluginInitCall(byte Function, char *str)
  \*********************************************************************************************/
 byte PluginTXInitCall(byte Function, char *str)
 {
-  int x;
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    if (Plugin_TX(x))
+      Plugin_TX(x)(Function, str);
+  return true;
+}
+#if (defined(ESP32) || defined(ESP8266))
+PluginStatsStruct Plugin_Stats[PLUGIN_COUNT];
+
+void PluginStatsReset()
+{
+  memset(Plugin_Stats, 0, sizeof(Plugin_Stats));
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    Plugin_Stats[x].Min_cycles = UINT32_MAX;
+}
+
+static void PluginStatsAdd(byte x, uint32_t cycles, boolean decoded)
+{
+  PluginStatsStruct *stats = &Plugin_Stats[x];
 
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
+  stats->Calls++;
+  if (decoded)
   {
-    if (PluginTX_id[x] != 0)
-    {
-      PluginTX_ptr[x](Function, str);
-    }
+    if (Event.State != EVENT_FREE) // Events are sent after each packet, so this one is new
+      stats->Decoded++;
+    else
+      stats->Repeats++;
   }
-  return true;
+  else if (cycles < PLUGIN_FAST_CYCLES)
+    stats->Fast++;
+  else
+    stats->Slow++;
+  if (cycles < stats->Min_cycles)
+    stats->Min_cycles = cycles;
+  if (cycles > stats->Max_cycles)
+    stats->Max_cycles = cycles;
+  stats->Total_cycles += cycles;
+}
+#endif
+
+// Packet within the marks and spaces the plugin in slot x decodes. True when PulseClass does
+// not describe it.
+static boolean PluginRXFits(byte x, const RawSignalStruct *RawSignal)
+{
+  const PluginShape *shape = &Plugin_Table[x].Shape;
+
+  if (!Classify_Describes(RawSignal))
+    return true;
+  return (PulseClass.MarkMin >= pgm_read_byte(&shape->MarkMin)) && (PulseClass.MarkMax <= pgm_read_byte(&shape->MarkMax)) &&
+         (PulseClass.SpaceMin >= pgm_read_byte(&shape->SpaceMin)) && (PulseClass.SpaceMax <= pgm_read_byte(&shape->SpaceMax));
+}
+
+PluginResultStruct PluginResult;
+static boolean PluginRX_Rewriting; // PluginRX_Rewrite() called by the plugin running
+
+RawSignalStruct *PluginRX_Rewrite(const RawSignalStruct *signal)
+{
+#if (defined(ESP32) || defined(ESP8266))
+  static RawSignalStruct Copy;
+
+  if (signal != &Copy)
+    memcpy(&Copy, signal, sizeof(Copy));
+  PluginResult.Rewritten = &Copy;
+#else
+  PluginResult.Rewritten = (RawSignalStruct *)signal;
+#endif
+  PluginRX_Rewriting = true;
+  return PluginResult.Rewritten;
+}
+
+// Plugin in slot x, when enabled. Given the packet as rewritten by the plugins before it, if any.
+static boolean PluginRXTry(byte x, byte Function, const RawSignalStruct *RawSignal)
+{
+  boolean decoded;
+
+  if (PluginResult.Rewritten)
+    RawSignal = PluginResult.Rewritten;
+  if (!Plugin_IsEnabled(x))
+    return false;
+  if (!PluginRXFits(x, RawSignal))
+  {
+#if (defined(ESP32) || defined(ESP8266))
+    Plugin_Stats[x].Rejected++;
+#endif
+    return false;
+  }
+  Repeat_Begin();
+  PluginResult.Quiet = false;
+  PluginResult.Quiet_ms = SIGNAL_REPEAT_TIME_MS;
+  PluginRX_Rewriting = false;
+  Event_Source = Plugin_Id(x);
+#if (defined(ESP32) || defined(ESP8266))
+  uint32_t start = ESP.getCycleCount();
+  decoded = Plugin_RX(x)(Function, RawSignal);
+  PluginStatsAdd(x, ESP.getCycleCount() - start, decoded);
+#else
+  decoded = Plugin_RX(x)(Function, RawSignal);
+#endif
+  Event_Source = 0;
+  if (!decoded && (Event.State == EVENT_OPEN)) // Given up half way through its message
+    Event.State = EVENT_FREE;
+  if (decoded)
+    Repeat_Commit();
+  else if (PluginRX_Rewriting) // The next plugins look at the new packet
+    Classify_Pulses(PluginResult.Rewritten, &PulseClass);
+  return decoded;
 }
 /*********************************************************************************************\
  * With this function plugins are called that have Receive functionality. 
  \*********************************************************************************************/
-byte PluginRXCall(byte Function, char *str)
+byte PluginRXCall(byte Function, const RawSignalStruct *RawSignal)
 {
-  unsigned long tmp = SignalCRC;
-  for (byte x = 0; x < PLUGIN_MAX; x++)
-  {
-    if ((Plugin_id[x] != 0) && (Plugin_State[x] >= P_Enabled))
-    {
-      SignalHash = x; // store plugin number
-      if (Plugin_ptr[x](Function, str))
+  PluginResult.Rewritten = NULL;
+#if (defined(ESP32) || defined(ESP8266))
+  // Pre-pass plugins (001), the plugins indexed for this length, then the fallback ones (254).
+  // The length is looked up after the pre-pass, as it may rewrite the packet.
+  byte always = 0;
+  int n;
+
+  for (; (always < Plugin_AlwaysCount) && (Plugin_Always[always] < Plugin_IndexFirst); always++)
+    if (PluginRXTry(Plugin_Always[always], Function, RawSignal))
+      return true;
+
+  n = (PluginResult.Rewritten ? PluginResult.Rewritten : RawSignal)->Number;
+  if ((n >= 0) && (n <= RAW_BUFFER_SIZE))
+    for (uint16_t i = Plugin_IndexStart[n]; i < Plugin_IndexStart[n + 1]; i++)
+      if (PluginRXTry(Plugin_Index[i], Function, RawSignal))
       {
-        SignalHashPrevious = SignalHash; // store previous plugin number after success
+        Plugin_Hits[Plugin_Index[i]]++;
+        if (++Plugin_Decodes >= PLUGIN_REORDER_HITS)
+          PluginRXReorder();
         return true;
       }
-      SignalCRC = tmp;  // restore SignalCRC, because some plugins change it even if they return false
-    }
-  }
+
+  for (; always < Plugin_AlwaysCount; always++)
+    if (PluginRXTry(Plugin_Always[always], Function, RawSignal))
+      return true;
+#else
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    if (PluginRXTry(x, Function, RawSignal))
+      return true;
+#endif
   return false;
 }
+/*********************************************************************************************\
+ * True when an enabled plugin decodes packets of that many pulses, or when RF debug shows them all.
+ \*********************************************************************************************/
+boolean PluginRXAccepts(int pulses)
+{
+  if (RFDebug || QRFDebug || RFUDebug || QRFUDebug)
+    return true;
+  if ((pulses < 0) || (pulses > RAW_BUFFER_SIZE))
+    return false;
+  return (Plugin_PulsesMap[pulses >> 5] >> (pulses & 31)) & 1;
+}
 /*********************************************************************************************\
  * With this function plugins are called that have Transmit functionality. 
  \*********************************************************************************************/
 byte PluginTXCall(byte Function, char *str)
 {
-  int x;
-
-  for (x = 0; x < PLUGIN_TX_MAX; x++)
-  {
-    if (PluginTX_id[x] != 0)
-    {
-      if (PluginTX_ptr[x](Function, str))
-      {
-        return true;
-      }
-    }
-  }
+  for (byte x = 0; x < PLUGIN_COUNT; x++)
+    if (Plugin_TX(x) && Plugin_TX(x)(Function, str))
+      return true;
   return false;
 }
 /*********************************************************************************************/
@@ -9,26 +9,110 @@
 #define Plugin_h
 
 #include <Arduino.h>
+#include "2_Signal.h"
 
-#define PLUGIN_MAX 55   // 55         // Maximum number of Receive plugins
-#define PLUGIN_TX_MAX 5 // 26         // Maximum number of Transmit plugins
+#define PLUGIN_NAME_SIZE 53    // 53         // Longest PLUGIN_DESC_xxx, terminating 0 included
+#define PLUGIN_REORDER_HITS 64 // 64         // Decodes between two reorderings of the plugins by hits (ESP only)
+#define PLUGIN_FAST_CYCLES 500 // 500        // Plugins refusing a packet within this many CPU cycles count a fast reject (ESP only)
+#define PLUGIN_STATE_FILE "/plugins.bin" // "/plugins.bin" // Plugins turned off with 10;PLUGIN=<id>;OFF; (ESP only)
+#define PLUGIN_STATE_EEPROM 0  // 0          // EEPROM address of the plugins turned off (AVR only)
 
-enum PState
+// n as in the file name: 1##n - 1000 reads 036 as 36, where 036 alone would be octal
+#define PLUGIN_ID(n) (1##n - 1000)
+
+#define PLUGIN_ANY_LENGTH 0x01 // Flags: called for any packet, before (001) or after (254) those of its length
+
+// Marks and spaces a plugin can decode, in RAWSIGNAL_SAMPLE_RATE units, over the pulses
+// PulseClass gathers them from (2..Number-1). Packets out of them are refused without
+// calling the plugin. 0..0xFF when the plugin has no entry in Plugin_Shapes[].
+struct PluginShape
+{
+  byte MarkMin;
+  byte MarkMax;
+  byte SpaceMin;
+  byte SpaceMax;
+};
+
+// ***********************************************************************************
+// Plugin descriptors
+// Built at compile time from the enabled plugins in Plugins/_Plugin_Config_01.h, and kept
+// in flash. Only whether each one is enabled lives in RAM, one bit per plugin.
+// ***********************************************************************************
+struct PluginDescriptor
+{
+  byte Id;                                // Plugin number, as in Plugin_xxx.c
+  byte Flags;                             // PLUGIN_ANY_LENGTH
+  int16_t Min;                            // Shortest packet decoded, in pulses
+  int16_t Max;                            // Longest packet decoded, in pulses
+  PluginShape Shape;                      // Marks and spaces decoded
+  boolean (*RX)(byte, const RawSignalStruct *); // Receive function, called with the packet to decode
+  boolean (*TX)(byte, char *);            // Transmit function, NULL when the plugin does not send
+  char Name[PLUGIN_NAME_SIZE];            // PLUGIN_DESC_xxx
+};
+
+extern const PluginDescriptor Plugin_Table[] PROGMEM;
+extern const byte Plugin_Count;
+extern uint32_t Plugin_Enabled[];
+
+typedef boolean (*PluginRXFunction)(byte, const RawSignalStruct *);
+typedef boolean (*PluginTXFunction)(byte, char *);
+
+inline byte Plugin_Id(byte x) { return pgm_read_byte(&Plugin_Table[x].Id); }
+inline byte Plugin_Flags(byte x) { return pgm_read_byte(&Plugin_Table[x].Flags); }
+inline int Plugin_Min(byte x) { return (int16_t)pgm_read_word(&Plugin_Table[x].Min); }
+inline int Plugin_Max(byte x) { return (int16_t)pgm_read_word(&Plugin_Table[x].Max); }
+inline PluginRXFunction Plugin_RX(byte x) { return (PluginRXFunction)pgm_read_ptr(&Plugin_Table[x].RX); }
+inline PluginTXFunction Plugin_TX(byte x) { return (PluginTXFunction)pgm_read_ptr(&Plugin_Table[x].TX); }
+inline PGM_P Plugin_Name(byte x) { return Plugin_Table[x].Name; }
+inline boolean Plugin_IsEnabled(byte x) { return (Plugin_Enabled[x >> 5] >> (x & 31)) & 1; }
+void Plugin_Enable(byte x, boolean enabled);
+byte Plugin_Slot(byte id); // Slot of plugin id, Plugin_Count when it is not built in
+
+// Plugins turned off, by plugin number, in flash. Load is false when nothing valid is stored.
+boolean PluginStateLoad(void);
+boolean PluginStateSave(void);
+
+#if (defined(ESP32) || defined(ESP8266))
+extern unsigned int Plugin_Hits[]; // Recent decodes per slot, the order plugins are tried in
+
+// Receive plugin calls per slot, timed in CPU cycles. Dumped by 10;PLUGINSTATS;
+struct PluginStatsStruct
+{
+  unsigned long Calls;
+  unsigned long Decoded;  // Returned true with a message
+  unsigned long Repeats;  // Returned true without a message, a repeat suppressed through Repeat_Seen()
+  unsigned long Fast;     // Returned false within PLUGIN_FAST_CYCLES, eg. on the pulse count
+  unsigned long Slow;     // Returned false after looking into the pulses
+  unsigned long Rejected; // Not called, the packet being out of its Plugin_Shapes[] entry
+  uint32_t Min_cycles;
+  uint32_t Max_cycles;
+  uint64_t Total_cycles;
+};
+
+extern PluginStatsStruct Plugin_Stats[];
+#endif
+
+// ***********************************************************************************
+// Receive plugin result
+// Plugins get the packet read only. Returning true is their answer, the packet decoded and
+// no other plugin to see it. Anything else they leave for the dispatcher goes here: reset
+// before each call, and only applied by PluginRXCall() and ScanEvent() once the plugin
+// returned. The key repeats are filtered on is left through Repeat_Seen(), and only
+// stored on a decode as well.
+// ***********************************************************************************
+struct PluginResultStruct
 {
-    P_Forbidden,
-    P_Disabled,
-    P_Enabled,
-    P_Mandatory
+  boolean Quiet;              // Decoded packet is sent several times: skip its copies for Quiet_ms
+  unsigned int Quiet_ms;      // SIGNAL_REPEAT_TIME_MS unless the plugin sets its own, 0 for no quiet window at all
+  RawSignalStruct *Rewritten; // Packet rewritten through PluginRX_Rewrite(), the next plugins get it. Kept until the next packet
 };
 
-extern boolean (*Plugin_ptr[PLUGIN_MAX])(byte, char *); // Receive plugins
-extern byte Plugin_id[PLUGIN_MAX];
-extern byte Plugin_State[PLUGIN_MAX];
-extern String Plugin_Description[PLUGIN_MAX];
+extern PluginResultStruct PluginResult;
 
-extern boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, char *); // Transmit plugins
-extern byte PluginTX_id[PLUGIN_TX_MAX];
-extern byte PluginTX_State[PLUGIN_TX_MAX];
+// Copy of signal a plugin may rewrite, eg. to route it to another plugin through Pulses[0].
+// Copied on the first call for a packet only. On AVR, where RAM has no room for a second
+// packet, signal itself: the receive buffer is only read again on the next packet.
+RawSignalStruct *PluginRX_Rewrite(const RawSignalStruct *signal);
 
 extern boolean RFDebug;   // debug RF signals with plugin 001 (no decode)
 extern boolean QRFDebug;  // debug RF signals with plugin 001 but no multiplication (faster?, compact)
@@ -40,7 +124,13 @@ void PluginInit(void);
 void PluginTXInit(void);
 byte PluginInitCall(byte Function, char *str);
 byte PluginTXInitCall(byte Function, char *str);
-byte PluginRXCall(byte Function, char *str);
+byte PluginRXCall(byte Function, const RawSignalStruct *RawSignal);
+boolean PluginRXAccepts(int pulses); // Worth a PluginRXCall(), from the plugins pulse count checks
 byte PluginTXCall(byte Function, char *str);
+#if (defined(ESP32) || defined(ESP8266))
+byte PluginRXOrder(int pulses, byte i); // Slot of the i-th plugin PluginRXCall() tries on a packet of that many pulses, Plugin_Count past the last
+void PluginRXOrderReset(void);
+void PluginStatsReset(void);
+#endif
 
 #endif
\ No newline at end of file
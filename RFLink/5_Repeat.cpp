@@ -0,0 +1,79 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "5_Repeat.h"
+
+struct RepeatEntry
+{
+  unsigned long Payload;
+  unsigned long Time; // millis() when last seen
+  byte Plugin;        // 0 when the entry is free
+};
+
+static RepeatEntry Repeat_Cache[REPEAT_CACHE_SIZE];
+static byte Repeat_PendingPlugin = 0; // Key of the plugin being called, 0 for none
+static unsigned long Repeat_PendingPayload;
+
+static RepeatEntry *Repeat_Find(byte plugin, unsigned long payload)
+{
+  for (byte i = 0; i < REPEAT_CACHE_SIZE; i++)
+    if ((Repeat_Cache[i].Plugin == plugin) && (Repeat_Cache[i].Payload == payload))
+      return &Repeat_Cache[i];
+  return NULL;
+}
+
+void Repeat_Reset()
+{
+  memset(Repeat_Cache, 0, sizeof(Repeat_Cache));
+  Repeat_PendingPlugin = 0;
+}
+
+void Repeat_Begin()
+{
+  Repeat_PendingPlugin = 0;
+}
+
+void Repeat_Commit()
+{
+  unsigned long now = millis();
+  RepeatEntry *entry;
+
+  if (!Repeat_PendingPlugin)
+    return;
+  entry = Repeat_Find(Repeat_PendingPlugin, Repeat_PendingPayload);
+  if (!entry)
+  {
+    entry = &Repeat_Cache[0]; // Free entry, or else the least recently seen one
+    for (byte i = 0; (i < REPEAT_CACHE_SIZE) && entry->Plugin; i++)
+      if (!Repeat_Cache[i].Plugin || (now - Repeat_Cache[i].Time > now - entry->Time))
+        entry = &Repeat_Cache[i];
+    entry->Plugin = Repeat_PendingPlugin;
+    entry->Payload = Repeat_PendingPayload;
+  }
+  entry->Time = now;
+  Repeat_PendingPlugin = 0;
+}
+
+boolean Repeat_Seen(byte plugin, unsigned long payload, unsigned int window_ms)
+{
+  RepeatEntry *entry = Repeat_Find(plugin, payload);
+
+  Repeat_PendingPlugin = plugin;
+  Repeat_PendingPayload = payload;
+  return entry && (millis() - entry->Time <= window_ms);
+}
+
+boolean Repeat_Recent(byte plugin, unsigned int window_ms)
+{
+  unsigned long now = millis();
+
+  for (byte i = 0; i < REPEAT_CACHE_SIZE; i++)
+    if ((Repeat_Cache[i].Plugin == plugin) && (now - Repeat_Cache[i].Time <= window_ms))
+      return true;
+  return false;
+}
@@ -0,0 +1,32 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Repeat_h
+#define Repeat_h
+
+#include <Arduino.h>
+
+#define REPEAT_CACHE_SIZE 8 // 8          // Decoded packets remembered to filter out their repeats, from as many senders at once
+
+// ***********************************************************************************
+// Repeat filter
+// Senders transmit each packet several times. Plugins look their decoded payload up with
+// Repeat_Seen(), keyed by their plugin number (PLUGIN_ID()), and leave with true when it
+// was seen within their window. Keys only go into the cache when the plugin then returns
+// true: PluginRXTry() calls Repeat_Commit(), so a payload refused by a later check of the
+// plugin is not taken as seen. The least recently seen key makes room for a new one.
+// ***********************************************************************************
+void Repeat_Reset();
+void Repeat_Begin();  // Before each plugin call, forgets the pending key
+void Repeat_Commit(); // After a plugin returned true, stores or refreshes the pending key
+
+// Payload decoded by plugin seen within the last window_ms. It becomes the pending key.
+boolean Repeat_Seen(byte plugin, unsigned long payload, unsigned int window_ms);
+// Any payload of plugin seen within the last window_ms, eg. to mute a protocol after another one
+boolean Repeat_Recent(byte plugin, unsigned int window_ms);
+
+#endif
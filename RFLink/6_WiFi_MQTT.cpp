@@ -9,6 +9,7 @@
 #include "RFLink.h"
 #include "3_Serial.h"
 #include "4_Display.h"
+#include "4_Event.h"
 #include "6_WiFi_MQTT.h"
 #ifdef AUTOCONNECT_ENABLED
 #include "9_AutoConnect.h"
@@ -32,8 +33,18 @@
 // MQTT_SOCKET_TIMEOUT: socket timeout interval in Seconds
 #define MQTT_SOCKET_TIMEOUT 60
 
+// MQTT_RETRY_MS : wait after a failed connection attempt, in mSec
+#define MQTT_RETRY_MS 5000
+
 #include <PubSubClient.h>
+
+// MQTT_BUFFER_SIZE : the longest topic and JSON event, past the fixed header and the topic length
+#define MQTT_BUFFER_SIZE (MQTT_MAX_HEADER_SIZE + 2 + MQTT_TOPIC_SIZE + MQTT_JSON_SIZE)
+
 boolean bResub; // uplink reSubscribe after setup only
+static boolean MQTT_Retry = false; // A connection attempt failed, the next one waits for MQTT_RetryAt
+static unsigned long MQTT_RetryAt;
+boolean MQTT_JSON = MQTT_JSON_0;
 
 // Update these with values suitable for your network.
 
@@ -83,9 +94,12 @@ void setup_MQTT()
   if (MQTT_PORT == "")
     MQTT_PORT = "1883"; // just in case ....
   MQTTClient.setClient(WIFIClient);
+  if (!MQTTClient.setBufferSize(MQTT_BUFFER_SIZE))
+    Serial.println(F("MQTT Buffer :\t\tNo memory, long events are not published"));
   MQTTClient.setServer(MQTT_SERVER.c_str(), MQTT_PORT.toInt());
   MQTTClient.setCallback(callback);
   bResub = true;
+  MQTT_Retry = false; // New settings are tried at once
 }
 
 void callback(char *topic, byte *payload, unsigned int length)
@@ -94,76 +108,92 @@ void callback(char *topic, byte *payload, unsigned int length)
   CheckMQTT(payload);
 }
 
-void reconnect()
+boolean reconnect()
 { // MQTT connection (documented way from AutoConnect : https://github.com/Hieromon/AutoConnect/tree/master/examples/mqttRSSI_NA)
-
-#ifdef AUTOCONNECT_ENABLED
-  uint8_t retry = 3;
-#endif // AUTOCONNECT_ENABLED
+  // One attempt per call, then none for MQTT_RETRY_MS: receiving and the other outputs go on meanwhile
+  if (MQTTClient.connected())
+    return true;
+  if (MQTT_Retry && ((long)(millis() - MQTT_RetryAt) < 0))
+    return false;
 
   bResub = true;
-  while (!MQTTClient.connected())
+  Serial.print(F("MQTT Server :\t\t"));
+  Serial.println(MQTT_SERVER.c_str());
+  Serial.print(F("MQTT Connection :\t"));
+
+  if (MQTTClient.connect(MQTT_ID.c_str(), MQTT_USER.c_str(), MQTT_PSWD.c_str()))
   {
-    Serial.print(F("MQTT Server :\t\t"));
-    Serial.println(MQTT_SERVER.c_str());
-    Serial.print(F("MQTT Connection :\t"));
-
-    if (MQTTClient.connect(MQTT_ID.c_str(), MQTT_USER.c_str(), MQTT_PSWD.c_str()))
-    {
-      Serial.println(F("Established"));
-      Serial.print(F("MQTT ID :\t\t"));
-      Serial.println(MQTT_ID.c_str());
-      Serial.print(F("MQTT Username :\t\t"));
-      Serial.println(MQTT_USER.c_str());
-    }
-    else
-    {
-      Serial.print(F("Failed - rc="));
-      Serial.println(MQTTClient.state());
-#ifdef AUTOCONNECT_ENABLED
-      if (!--retry)
-        break;
-      delay(500);
-#else  // AUTOCONNECT_ENABLED
-      Serial.println(F("MQTT Retry :\tTry again in 5 seconds"));
-      // Wait 5 seconds before retrying
-      for (byte i = 0; i < 10; i++)
-        delay(500); // delay(5000) may cause hang
-#endif // AUTOCONNECT_ENABLED
-    }
+    Serial.println(F("Established"));
+    Serial.print(F("MQTT ID :\t\t"));
+    Serial.println(MQTT_ID.c_str());
+    Serial.print(F("MQTT Username :\t\t"));
+    Serial.println(MQTT_USER.c_str());
+    MQTT_Retry = false;
+    return true;
   }
+  Serial.print(F("Failed - rc="));
+  Serial.println(MQTTClient.state());
+  Serial.println(F("MQTT Retry :\tTry again in 5 seconds"));
+  MQTT_Retry = true;
+  MQTT_RetryAt = millis() + MQTT_RETRY_MS;
+  return false;
 }
 
-void publishMsg()
-{
 #ifndef AUTOCONNECT_ENABLED
-  static boolean MQTT_RETAINED = MQTT_RETAINED_0;
+static boolean MQTT_RETAINED = MQTT_RETAINED_0;
 #endif // !AUTOCONNECT_ENABLED
 
+boolean publishMsg(const char *text, size_t length)
+{
   if (!MQTTClient.connected())
-    reconnect();
-  MQTTClient.publish(MQTT_TOPIC_OUT.c_str(), pbuffer, MQTT_RETAINED);
+    return false; // Kept queued, checkMQTTloop() reconnects
+  if (!MQTTClient.publish(MQTT_TOPIC_OUT.c_str(), (const uint8_t *)text, length, MQTT_RETAINED))
+  {
+    if (!MQTTClient.connected())
+      return false; // Lost while sending: kept queued
+    Msg.Overflows++; // Larger than the client buffer: not kept
+  }
+  return true;
 }
 
-void checkMQTTloop()
+boolean publishEvent(const EventStruct *event)
 {
-  static unsigned long lastCheck = millis();
+  char topic[MQTT_TOPIC_SIZE];
+  char json[MQTT_JSON_SIZE];
+  MessageBuilder topic_out = {topic, sizeof(topic), 0, 0};
+  MessageBuilder json_out = {json, sizeof(json), 0, 0};
 
-  if (millis() > lastCheck + MQTT_LOOP_MS)
+  if (!MQTTClient.connected())
+    return false;
+  if (!topic_out.Put(MQTT_TOPIC_OUT.c_str()) || !Event_Topic(&topic_out, event))
+  {
+    Msg.Overflows++;
+    return true; // Never fits: not kept
+  }
+  if (!Event_Json(&json_out, event))
+    Msg.Overflows++; // Sent without the fields that did not fit
+  if (!MQTTClient.publish(topic, (const uint8_t *)json, json_out.Length, MQTT_RETAINED))
   {
     if (!MQTTClient.connected())
-      reconnect();
-
-    if (bResub)
-    {
-      // Once connected, resubscribe
-      MQTTClient.subscribe(MQTT_TOPIC_IN.c_str());
-      bResub = false;
-      delay(10);
-    }
-    MQTTClient.loop();
-    lastCheck = millis();
+      return false;
+    Msg.Overflows++;
+  }
+  return true;
+}
+
+void checkMQTTloop() // Every MQTT_LOOP_MS, see loop() tasks
+{
+  if (!reconnect())
+    return; // Messages stay queued for MQTT meanwhile, see send_MQTT()
+
+  if (bResub)
+  {
+    // Once connected, resubscribe
+    MQTTClient.subscribe(MQTT_TOPIC_IN.c_str());
+    bResub = false;
+    delay(10);
   }
+  MQTTClient.loop();
 }
 #endif // MQTT_ENABLED
 
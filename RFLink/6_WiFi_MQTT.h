@@ -10,6 +10,7 @@
 
 #include <Arduino.h>
 #include "RFLink.h"
+#include "4_Event.h"
 
 #ifdef AUTOCONNECT_ENABLED
 extern String MQTT_SERVER;
@@ -31,15 +32,20 @@ extern String Adv_Power;
 #endif // AUTOCONNECT_ENABLED
 
 #ifdef MQTT_ENABLED
+#define MQTT_JSON_SIZE 192  // 192        // Longest JSON event published, built on the stack
+#define MQTT_TOPIC_SIZE 128 // 128        // Longest topic of a JSON event, MQTT_TOPIC_OUT included
+
 extern char MQTTbuffer[PRINT_BUFFER_SIZE]; // Buffer for MQTT message
+extern boolean MQTT_JSON;                  // Decoded events published as JSON, set with 10;MQTT=JSON|TEXT;
 
 #ifndef AUTOCONNECT_ENABLED
 void setup_WIFI();
 #endif // !AUTOCONNECT_ENABLED
 
 void setup_MQTT();
-void reconnect();
-void publishMsg();
+boolean reconnect(); // One attempt at most every MQTT_RETRY_MS, true when connected
+boolean publishMsg(const char *text, size_t length); // false when not connected, to be kept queued
+boolean publishEvent(const EventStruct *event);      // As JSON, false when not connected, to be kept queued
 void checkMQTTloop();
 #endif // MQTT_ENABLED
 
@@ -0,0 +1,83 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include "7_Scheduler.h"
+
+TaskStruct Tasks[TASK_MAX];
+byte Task_Count = 0;
+
+boolean Task_Add(const char *name, boolean (*function)(), unsigned int period_ms, unsigned long budget_us, byte priority)
+{
+  if (Task_Count >= TASK_MAX)
+    return false;
+
+  TaskStruct *task = &Tasks[Task_Count++];
+  memset(task, 0, sizeof(TaskStruct));
+  task->Function = function;
+  task->Name = name;
+  task->Period_ms = (period_ms ? period_ms : 1); // Never due all the time, others would starve
+  task->Budget_us = budget_us;
+  task->Priority = priority;
+  task->Due_ms = millis();
+  return true;
+}
+
+void Task_Run()
+{
+  unsigned long now = millis();
+  TaskStruct *task = NULL;
+
+  for (byte i = 0; i < Task_Count; i++)
+  {
+    TaskStruct *t = &Tasks[i];
+
+    if ((long)(now - t->Due_ms) < 0)
+      continue; // Not due
+    if (!task || (t->Priority > task->Priority) ||
+        ((t->Priority == task->Priority) && ((long)(t->Due_ms - task->Due_ms) < 0)))
+      task = t;
+  }
+  if (!task)
+    return;
+
+  unsigned long start_us = micros();
+  boolean busy = task->Function();
+  unsigned long elapsed_us = micros() - start_us;
+
+#ifdef TASK_STATS
+  task->Runs++;
+  task->Total_us += elapsed_us;
+  if (elapsed_us > task->Max_us)
+    task->Max_us = elapsed_us;
+  if (elapsed_us > task->Budget_us)
+    task->Overruns++;
+  if (busy)
+    task->Busy++;
+#endif
+
+  task->Used_us += elapsed_us;
+  if (!busy || (task->Used_us >= task->Budget_us))
+  { // Period is over, no catching up on missed ones
+    task->Used_us = 0;
+    task->Due_ms = now + task->Period_ms;
+  }
+}
+
+#ifdef TASK_STATS
+void Task_ResetStats()
+{
+  for (byte i = 0; i < Task_Count; i++)
+  {
+    Tasks[i].Runs = 0;
+    Tasks[i].Busy = 0;
+    Tasks[i].Overruns = 0;
+    Tasks[i].Total_us = 0;
+    Tasks[i].Max_us = 0;
+  }
+}
+#endif
@@ -0,0 +1,57 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef Scheduler_h
+#define Scheduler_h
+
+#include <Arduino.h>
+
+#if (defined(ESP32) || defined(ESP8266))
+#define TASK_MAX 6   // 6          // Maximum number of loop() tasks
+#define TASK_STATS   // Per task statistics, shown by 10;TASKS;
+#else
+#define TASK_MAX 3   // 3          // RF, Send and Serial, within the RAM of an AVR
+#endif
+
+// ***********************************************************************************
+// Cooperative scheduler
+// Each subsystem registers a task that does one bounded piece of work per call (eg. one
+// RF packet, one serial command) and returns true when there is more to do.
+// Every Period_ms a task becomes due. It is then called again as long as it has work
+// and its Budget_us for the period is not spent, so that it can only delay the others
+// by about one budget. Among due tasks, the highest Priority runs first, then the most
+// overdue one. One task runs per Task_Run(), loop() returns in between.
+// ***********************************************************************************
+struct TaskStruct
+{
+  boolean (*Function)();   // One piece of work, true when more is pending
+  const char *Name;        // PSTR(), shown by 10;TASKS;
+  unsigned int Period_ms;  // Due again that long after its previous period
+  unsigned long Budget_us; // Time it may use per period
+  byte Priority;           // Higher first among due tasks
+  unsigned long Due_ms;    // Start of next period
+  unsigned long Used_us;   // Spent in the current period
+#ifdef TASK_STATS
+  // Statistics
+  unsigned long Runs;      // Calls
+  unsigned long Busy;      // Calls that reported more work
+  unsigned long Overruns;  // Calls longer than the whole budget
+  unsigned long Total_us;  // Time in the task
+  unsigned long Max_us;    // Longest call
+#endif
+};
+
+extern TaskStruct Tasks[TASK_MAX];
+extern byte Task_Count;
+
+boolean Task_Add(const char *name, boolean (*function)(), unsigned int period_ms, unsigned long budget_us, byte priority);
+void Task_Run();
+#ifdef TASK_STATS
+void Task_ResetStats();
+#endif
+
+#endif
@@ -53,7 +53,7 @@ void splash_OLED()
     u8x8.setPowerSave(0);
 }
 
-void print_OLED()
+void print_OLED(char *text)
 {
     /*
     static char delim[2] = ";";
@@ -61,7 +61,7 @@ void print_OLED()
     static boolean ret;
 
  
-    ptr = strtok(pbuffer, delim);
+    ptr = strtok(text, delim);
     ret = false;
 
     while ((ptr != NULL) && (ptr[0] != '\r'))
@@ -76,8 +76,8 @@ void print_OLED()
     }
 */
     u8x8log.print('\f');
-    replacechar(pbuffer, ';', '\n');
-    u8x8log.print(pbuffer);
+    replacechar(text, ';', '\n');
+    u8x8log.print(text);
 }
 
 #endif // OLED_ENABLED
\ No newline at end of file
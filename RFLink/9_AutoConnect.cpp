@@ -79,42 +79,16 @@ void rootPage()
 
     if (webServer.hasArg("BtnSave"))
     {
-        // const int capacity = JSON_ARRAY_SIZE(254) + 2 * JSON_OBJECT_SIZE(2);
-        // StaticJsonDocument<4128> doc;
-        DynamicJsonDocument doc(4128);
-
-        for (byte x = 0; x < PLUGIN_MAX; x++)
+        for (byte x = 0; x < Plugin_Count; x++)
         {
-            if (Plugin_id[x] != 0)
-            {
-                // pour chaque plugin activé lors de la compilation du firmware,
-                // on créé un enregistrement dans le fichier protocols.json
-                // si le serveur a un argument c'est que la checkbox est cochée
-                if (webServer.hasArg(String(Plugin_id[x]) + "_ProtocolState"))
-                {
-                    doc[x][String(Plugin_id[x])] = 1;
-                    Plugin_State[x] = 2;
-                }
-                else
-                {
-                    doc[x][String(Plugin_id[x])] = 0;
-                    Plugin_State[x] = 1;
-                }
-            }
+            // si le serveur a un argument c'est que la checkbox est cochée
+            Plugin_Enable(x, webServer.hasArg(String(Plugin_Id(x)) + "_ProtocolState"));
         }
 
         Serial.print("Param ");
-        Serial.print(PROTOCOL_FILE);
+        Serial.print(F(PLUGIN_STATE_FILE));
         Serial.print(F(" :\t"));
-
-        LittleFS.begin();
-        File configFile = LittleFS.open(PROTOCOL_FILE, "w");
-        serializeJson(doc, configFile);
-
-        Serial.println(F("Saved"));
-        doc.clear();
-        configFile.close();
-        LittleFS.end();
+        Serial.println(PluginStateSave() ? F("Saved") : F("Failed to open(+w)"));
     }
 
     // This is the Home Page - Choose theme here : https://www.bootstrapcdn.com/bootswatch/?theme
@@ -213,36 +187,77 @@ void rootPage()
     content += "<thead><tr><th>N&deg;</th><th>Plugin Name</th><th>Enabled</th></tr></thead>"; // Table Header    // é = &eacute;
     content += "<tbody>";                                                                     // Table content
     content += "<form action='/' method='POST'>";
-    for (byte x = 0; x < PLUGIN_MAX; x++)
+    for (byte x = 0; x < Plugin_Count; x++)
+    {
+        ////////////////// One table line ///////////////////
+        x % 2 ? content += "<tr class='table-light'><td>" : content += "<tr><td>";
+
+        content += Plugin_Id(x);
+        content += "</td><td>";
+        content += FPSTR(Plugin_Name(x));
+        content += "</td><td>";
+        content += "<input type='checkbox' class='form-check-input' name='";
+        content += Plugin_Id(x);
+        content += "_ProtocolState' value='State'";
+
+        if (Plugin_IsEnabled(x))
+        {
+            content += " checked";
+        }
+        content += ">";
+        content += "</td>";
+        ////////////////// One table line ///////////////////
+    }
+
+    content += "</tr><tr><td></td><td></td><td></td></tr>"; // we add a last line to bottom of the table
+    content += "</tbody></table>";
+
+    content += "<button type='button submit' name='BtnSave' value='0' class='btn btn-secondary'>Save</button></form></div>";
+    content += "<Br>";
+
+    // Plugin profiler, as 10;PLUGINSTATS;
+    content += "<table class='table table-hover'  style='max-width: 50rem;'>";
+    content += "<thead><tr><th>N&deg;</th><th>Plugin Name</th><th>Calls</th><th>Decoded</th><th>Repeats</th><th>Fast rejects</th><th>Slow rejects</th><th>Shape rejects</th><th>Cycles min/avg/max</th></tr></thead>";
+    content += "<tbody>";
+    for (byte x = 0; x < Plugin_Count; x++)
     {
-        if ((Plugin_id[x] != 0)) //  && (Plugin_State[x] >= P_Enabled)
+        PluginStatsStruct *stats = &Plugin_Stats[x];
+
+        if (stats->Calls || stats->Rejected)
         {
             ////////////////// One table line ///////////////////
             x % 2 ? content += "<tr class='table-light'><td>" : content += "<tr><td>";
 
-            content += Plugin_id[x];
+            content += Plugin_Id(x);
             content += "</td><td>";
-            content += Plugin_Description[x];
+            content += FPSTR(Plugin_Name(x));
             content += "</td><td>";
-            content += "<input type='checkbox' class='form-check-input' name='";
-            content += Plugin_id[x];
-            content += "_ProtocolState' value='State'";
-
-            if (Plugin_State[x] == 2)
+            content += stats->Calls;
+            content += "</td><td>";
+            content += stats->Decoded;
+            content += "</td><td>";
+            content += stats->Repeats;
+            content += "</td><td>";
+            content += stats->Fast;
+            content += "</td><td>";
+            content += stats->Slow;
+            content += "</td><td>";
+            content += stats->Rejected;
+            content += "</td><td>";
+            if (stats->Calls)
             {
-                content += " checked";
+                content += stats->Min_cycles;
+                content += "/";
+                content += (unsigned long)(stats->Total_cycles / stats->Calls);
+                content += "/";
+                content += stats->Max_cycles;
             }
-            content += ">";
-            content += "</td>";
+            content += "</td></tr>";
             ////////////////// One table line ///////////////////
         }
     }
-
-    content += "</tr><tr><td></td><td></td><td></td></tr>"; // we add a last line to bottom of the table
     content += "</tbody></table>";
 
-    content += "<button type='button submit' name='BtnSave' value='0' class='btn btn-secondary'>Save</button></form></div>";
-
     content += "</body>";
     content += "</html>";
 
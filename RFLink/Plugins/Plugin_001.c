@@ -69,6 +69,7 @@
  \*********************************************************************************************/
 #define P001_PLUGIN_ID 001
 #define PLUGIN_DESC_001 "Long Packet Translation and debugging"
+#define PLUGIN_PULSES_001 // Any length, PLUGIN_ANY_LENGTH
 #define OVERSIZED_LIMIT 291 // longest packet is handled by plugin 48
 
 #define PULSE500 500 / RAWSIGNAL_SAMPLE_RATE
@@ -87,7 +88,7 @@
 #ifdef PLUGIN_001
 #include "../4_Display.h"
 
-boolean Plugin_001(byte function, char *string)
+boolean Plugin_001(byte function, const RawSignalStruct *RawSignal)
 {
    // byte HEconversiontype = 1; // 0=No conversion, 1=conversion to Elro 58 pulse protocol (same as FA500R Method 1)
 
@@ -165,15 +166,15 @@ boolean Plugin_001(byte function, char *string)
    //PROGMEM int temp[]={270,930,210,930,210,930,870,270,180,930,870,270,180,930,870,270,180,930,840,270,180,930,210,930,210,930,870,270,180,930,870,270,180,930,870,270,180,930,870,270,210,930,180,930,180,930,840,270,180,6990};
    //Xiron
    //PROGMEM int temp[]={990,870,900,870,870,390,390,390,390,870,390,390,870,390,390,900,390,390,390,390,870,390,390,390,390,870,390,390,870,390,390,870,390,390,390,390,900,870,390,390,870,870,870,870,870,390,390,870,870,870,390,390,870,870,390,390,870,390,390,390,390,870,390,390,870,390,390,390,390,390,390,390,390,390,390,870,870,870,870,870,870,390,390,390,390,870,870,390,390,870,390,390,870,870,390,390,870,900,390,390,390,390,390,390,30,6990};
-   //if (RawSignal.Number==66){
+   //if (RawSignal->Number==66){
    //   for (i=0;i<160;i++) {
-   //       //RawSignal.Pulses[1+i]=temp[i]/25;
-   //       RawSignal.Pulses[1+i]=temp[i]/RawSignal.Multiply;
+   //       //RawSignal->Pulses[1+i]=temp[i]/25;
+   //       RawSignal->Pulses[1+i]=temp[i]/RawSignal->Multiply;
    //   }
-   //   RawSignal.Number=106;
+   //   RawSignal->Number=106;
    //}
    // -
-   //if (RawSignal.Number==66){
+   //if (RawSignal->Number==66){
    //Serial.print("20;01;LaCrosseV2;ID=0606;");         // Label
    // ----------------------------------
    //int sensordata=0x0e;   // 9=203 10=225
@@ -189,11 +190,10 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Kill ALL Short RF packets
    // ==========================================================================
-   if (RawSignal.Number < 24)
+   if (RawSignal->Number < 24)
    { // Less than 24 pulses?
       if ((RFDebug == true) || (QRFDebug == true))
       {
-         RawSignal.Number = 0; // Kill packet
          return true;          // abort further processing
       }
       else
@@ -212,44 +212,48 @@ boolean Plugin_001(byte function, char *string)
       display_Footer();
       // ----------------------------------
       Serial.print(F("20;XX;DEBUG;Pulses=")); // debug data
-      Serial.print(RawSignal.Number);         // print number of pulses
+      Serial.print(RawSignal->Number);         // print number of pulses
       Serial.print(F(";Pulses(uSec)="));      // print pulse durations
       // ----------------------------------
       char dbuffer[3];
 
-      for (i = 1; i < RawSignal.Number + 1; i++)
+      for (i = 1; i < RawSignal->Number + 1; i++)
       {
          if (QRFDebug == true)
          {
-            sprintf(dbuffer, "%02x", RawSignal.Pulses[i]);
+            sprintf(dbuffer, "%02x", RawSignal->Pulses[i]);
             Serial.print(dbuffer);
          }
          else
          {
-            Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
-            if (i < RawSignal.Number)
+            Serial.print(RawSignal->Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
+            if (i < RawSignal->Number)
                Serial.write(',');
          }
       }
+      if (RawSignal->Repairs)
+      {
+         Serial.print(F(";Repairs=")); // spikes merged while receiving
+         Serial.print(RawSignal->Repairs);
+      }
       Serial.print(F(";\r\n"));
       // ----------------------------------
-      RawSignal.Number = 0; // Last plugin, kill packet
       return true;          // stop processing
    }
    // ==========================================================================
    // Beginning of Signal translation for Impuls
    // ==========================================================================
    // 20;D7;DEBUG;Pulses=250;Pulses(uSec)=275,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,350,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,75,350,75,325,375,25,75,4700,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,75,325,75,350,375,25,75,4700,75,350,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,375,25,75,350,375,25,75,325,375,25,75,325,375,25,75,325,375,25,75,350,375,25,75,350,75,325,75,350,375,25,75;
-   // if ((RawSignal.Number == 250) || (RawSignal.Number == RAW_BUFFER_SIZE - 1))
+   // if ((RawSignal->Number == 250) || (RawSignal->Number == RAW_BUFFER_SIZE - 1))
    // { // Impuls
-   //    if (RawSignal.Pulses[50] > PULSE4200)
+   //    if (RawSignal->Pulses[50] > PULSE4200)
    //    {
-   //       if (RawSignal.Pulses[100] > PULSE4200)
+   //       if (RawSignal->Pulses[100] > PULSE4200)
    //       {
-   //          if (RawSignal.Pulses[150] > PULSE4200)
+   //          if (RawSignal->Pulses[150] > PULSE4200)
    //          {
-   //             RawSignal.Number = 50;    // New packet length
-   //             RawSignal.Pulses[0] = 61; // signal the plugin number that should process this packet
+   //             RawSignal->Number = 50;    // New packet length
+   //             RawSignal->Pulses[0] = 61; // signal the plugin number that should process this packet
    //             return false;             // packet detected, conversion done
    //          }
    //       }
@@ -261,16 +265,16 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Home Confort Switches/Remotes
    // ==========================================================================
-   // if (RawSignal.Number == 200)
+   // if (RawSignal->Number == 200)
    // {
-   //    if (RawSignal.Pulses[1] > PULSE2000)
+   //    if (RawSignal->Pulses[1] > PULSE2000)
    //    {
-   //       if (RawSignal.Pulses[100] > PULSE4000)
+   //       if (RawSignal->Pulses[100] > PULSE4000)
    //       {
-   //          if (RawSignal.Pulses[101] > PULSE2000)
+   //          if (RawSignal->Pulses[101] > PULSE2000)
    //          {
-   //             RawSignal.Number = 100;   // New packet length
-   //             RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
+   //             RawSignal->Number = 100;   // New packet length
+   //             RawSignal->Pulses[0] = 11; // signal the plugin number that should process this packet
    //             return false;             // packet detected, conversion done
    //          }
    //       }
@@ -282,18 +286,18 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Intertek Unitec Switches/Remotes
    // ==========================================================================
-   // if (RawSignal.Number == 202)
+   // if (RawSignal->Number == 202)
    // {
-   //    if (RawSignal.Pulses[2] > PULSE2000)
+   //    if (RawSignal->Pulses[2] > PULSE2000)
    //    {
-   //       if (RawSignal.Pulses[52] > PULSE2000)
+   //       if (RawSignal->Pulses[52] > PULSE2000)
    //       {
-   //          if (RawSignal.Pulses[102] > PULSE2000)
+   //          if (RawSignal->Pulses[102] > PULSE2000)
    //          {
-   //             if (RawSignal.Pulses[1] < PULSE500)
+   //             if (RawSignal->Pulses[1] < PULSE500)
    //             {
-   //                RawSignal.Number = 50;   // New packet length
-   //                RawSignal.Pulses[0] = 5; // signal the plugin number that should process this packet
+   //                RawSignal->Number = 50;   // New packet length
+   //                RawSignal->Pulses[0] = 5; // signal the plugin number that should process this packet
    //                return false;            // packet detected, conversion done
    //             }
    //          }
@@ -306,11 +310,11 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for HomeEasy HE844 mode 4 - compatibility mode
    // ==========================================================================
-   //if (RawSignal.Number == 234) {
+   //if (RawSignal->Number == 234) {
    //   if (HEconversiontype==0) {                 // Reject the entire packet
-   //      if ((RawSignal.Pulses[2] > PULSE4000) && (RawSignal.Pulses[2+58] > PULSE4000) && (RawSignal.Pulses[2+58+58] > PULSE4000) ){
-   //         RawSignal.Pulses[0]=15;                 // signal the plugin number that should process this packet
-   //         RawSignal.Number=0;                     // Kill packet
+   //      if ((RawSignal->Pulses[2] > PULSE4000) && (RawSignal->Pulses[2+58] > PULSE4000) && (RawSignal->Pulses[2+58+58] > PULSE4000) ){
+   //         RawSignal->Pulses[0]=15;                 // signal the plugin number that should process this packet
+   //         RawSignal->Number=0;                     // Kill packet
    //         return true;                            // abort processing
    //      }
    //   }
@@ -319,10 +323,21 @@ boolean Plugin_001(byte function, char *string)
    // End of Signal translation HomeEasy HE842
    // ==========================================================================
 
+   // ==========================================================================
+   // Beginning of Signal translation for Byron Doorbell
+   // Frame split from a burst with 2500-3000 us gaps
+   // ==========================================================================
+   if ((RawSignal->Number == 26) && (RawSignal->Repeats > 1) && (RawSignal->Pulses[26] > PULSE2500) && (RawSignal->Pulses[26] < PULSE3000))
+   {
+      PluginRX_Rewrite(RawSignal)->Pulses[0] = 72; // signal the plugin number that should process this packet
+      return false;                               // Conversion done, stop plugin 1 and continue with regular plugins
+   }
+   // ==========================================================================
+
    // ==========================================================================
    // END plugin 001 if the incoming packet is not oversized and resume normal processing of plugins
    // there is no need to do all the checks if there never will be a match
-   if (RawSignal.Number < OVERSIZED_LIMIT)
+   if (RawSignal->Number < OVERSIZED_LIMIT)
       return false;
    // ==========================================================================
    // ##########################################################################
@@ -333,18 +348,18 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Flamingo FA500R
    // ==========================================================================
-   // if (RawSignal.Number > 330 && RawSignal.Number < 378)
+   // if (RawSignal->Number > 330 && RawSignal->Number < 378)
    // {
-   //    int pos1 = RawSignal.Number - 130;
-   //    int pos2 = RawSignal.Number - 130 - 58;
-   //    if (RawSignal.Pulses[pos1] > PULSE2000 && RawSignal.Pulses[pos2] > PULSE4000)
+   //    int pos1 = RawSignal->Number - 130;
+   //    int pos2 = RawSignal->Number - 130 - 58;
+   //    if (RawSignal->Pulses[pos1] > PULSE2000 && RawSignal->Pulses[pos2] > PULSE4000)
    //    {
    //       for (i = 0; i < 58; i++)
    //       {
-   //          RawSignal.Pulses[1 + i] = RawSignal.Pulses[pos2 + 1 + i];
+   //          RawSignal->Pulses[1 + i] = RawSignal->Pulses[pos2 + 1 + i];
    //       }
-   //       RawSignal.Pulses[0] = 12; // Data will be processed by plugin 12
-   //       RawSignal.Number = 58;    // New packet length
+   //       RawSignal->Pulses[0] = 12; // Data will be processed by plugin 12
+   //       RawSignal->Number = 58;    // New packet length
    //       return false;             // Conversion done, stop plugin 1 and continue with regular plugins
    //    }
    // }
@@ -356,12 +371,12 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    //Conrad RSL
    //20;87;DEBUG;Pulses=462;Pulses(uSec)=1260,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6930,1230,420,510,1140,1230,420,1230,420,510,1140,1230,420,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,510,1140,1230,420,1230,420,1230,420,1230,420,1230,420,510,1140,1230,420,510,1140,510,1140,510,1140,510,1140,510,1140,510,6990;
-   // if (RawSignal.Number == 462)
+   // if (RawSignal->Number == 462)
    // {
-   //    if ((RawSignal.Pulses[66] > PULSE6500) && (RawSignal.Pulses[66 + 66] > PULSE6500) && (RawSignal.Pulses[66 + 66 + 66] > PULSE6500))
+   //    if ((RawSignal->Pulses[66] > PULSE6500) && (RawSignal->Pulses[66 + 66] > PULSE6500) && (RawSignal->Pulses[66 + 66 + 66] > PULSE6500))
    //    {
-   //       RawSignal.Number = 66;   // New packet length
-   //       RawSignal.Pulses[0] = 7; // signal the plugin number that should process this packet
+   //       RawSignal->Number = 66;   // New packet length
+   //       RawSignal->Pulses[0] = 7; // signal the plugin number that should process this packet
    //       return false;            // Conversion done, terminate plugin 1 and continue with regular plugins
    //    }
    // }
@@ -371,29 +386,29 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for HomeEasy HE842/HE852/HE863
    // ==========================================================================
-   // if (RawSignal.Number > 460)
-   // { // && RawSignal.Number < 470) {
+   // if (RawSignal->Number > 460)
+   // { // && RawSignal->Number < 470) {
    //    if (HEconversiontype == 0)
    //    { // Reject the entire packet
-   //       if ((RawSignal.Pulses[2] > PULSE4000) && (RawSignal.Pulses[2 + 58] > PULSE4000) && (RawSignal.Pulses[2 + 58 + 58] > PULSE4000))
+   //       if ((RawSignal->Pulses[2] > PULSE4000) && (RawSignal->Pulses[2 + 58] > PULSE4000) && (RawSignal->Pulses[2 + 58 + 58] > PULSE4000))
    //       {
-   //          RawSignal.Pulses[0] = 15; // Instruct plugin 3 to skip any packets it might see after this
-   //          RawSignal.Number = 0;     // Kill packet
+   //          RawSignal->Pulses[0] = 15; // Instruct plugin 3 to skip any packets it might see after this
+   //          RawSignal->Number = 0;     // Kill packet
    //          return true;              // abort processing
    //       }
    //    }
    //    else
    //    { // Convert to Elro Method 1 (same as FA500 Method 1)
-   //       int pos1 = RawSignal.Number - 58;
-   //       //if (RawSignal.Pulses[pos1]*RawSignal.Multiply > 4000) {
-   //       if (RawSignal.Pulses[pos1] > PULSE4000)
+   //       int pos1 = RawSignal->Number - 58;
+   //       //if (RawSignal->Pulses[pos1]*RawSignal->Multiply > 4000) {
+   //       if (RawSignal->Pulses[pos1] > PULSE4000)
    //       {
    //          for (i = 0; i < 58; i++)
    //          {
-   //             RawSignal.Pulses[1 + i] = RawSignal.Pulses[pos1 + 1 + i];
+   //             RawSignal->Pulses[1 + i] = RawSignal->Pulses[pos1 + 1 + i];
    //          }
-   //          RawSignal.Number = 58;   // New packet length
-   //          RawSignal.Pulses[0] = 7; // signal the plugin number that should process this packet
+   //          RawSignal->Number = 58;   // New packet length
+   //          RawSignal->Pulses[0] = 7; // signal the plugin number that should process this packet
    //          return false;            // Conversion done, stop plugin 1 and continue with regular plugins
    //       }
    //    }
@@ -409,16 +424,16 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Forrinx
    // ==========================================================================
-   // if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
+   // if (RawSignal->Number == RAW_BUFFER_SIZE - 1)
    // {
-   //    if ((RawSignal.Pulses[2] > PULSE6000) && (RawSignal.Pulses[2 + 50] > PULSE6000) && (RawSignal.Pulses[2 + 50 + 50] > PULSE6000))
+   //    if ((RawSignal->Pulses[2] > PULSE6000) && (RawSignal->Pulses[2 + 50] > PULSE6000) && (RawSignal->Pulses[2 + 50 + 50] > PULSE6000))
    //    {
    //       for (i = 0; i < 50; i++)
    //       {
-   //          RawSignal.Pulses[1 + i] = RawSignal.Pulses[3 + i]; // reorder pulse array
+   //          RawSignal->Pulses[1 + i] = RawSignal->Pulses[3 + i]; // reorder pulse array
    //       }
-   //       RawSignal.Number = 51;    // New packet length (report 51 and not 50 to avoid handling by other plugins
-   //       RawSignal.Pulses[0] = 76; // signal the plugin number that should process this packet
+   //       RawSignal->Number = 51;    // New packet length (report 51 and not 50 to avoid handling by other plugins
+   //       RawSignal->Pulses[0] = 76; // signal the plugin number that should process this packet
    //       return false;             // packet detected, conversion done
    //    }
    // }
@@ -426,13 +441,13 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for bofu
    // ==========================================================================
-   // if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
+   // if (RawSignal->Number == RAW_BUFFER_SIZE - 1)
    // {
-   //    if ((RawSignal.Pulses[1] > PULSE4200) && (RawSignal.Pulses[2] > PULSE2000) && (RawSignal.Pulses[3] > PULSE1100))
+   //    if ((RawSignal->Pulses[1] > PULSE4200) && (RawSignal->Pulses[2] > PULSE2000) && (RawSignal->Pulses[3] > PULSE1100))
    //    {
-   //       if ((RawSignal.Pulses[1 + 86] > PULSE4200) && (RawSignal.Pulses[2 + 86] > PULSE2000) && (RawSignal.Pulses[3 + 86] > PULSE1100))
+   //       if ((RawSignal->Pulses[1 + 86] > PULSE4200) && (RawSignal->Pulses[2 + 86] > PULSE2000) && (RawSignal->Pulses[3 + 86] > PULSE1100))
    //       {
-   //          RawSignal.Number = 85; // New packet length
+   //          RawSignal->Number = 85; // New packet length
    //          return false;          // Conversion done, stop plugin 1 and continue with regular plugins
    //       }
    //    }
@@ -444,72 +459,30 @@ boolean Plugin_001(byte function, char *string)
    // **************************************************************************
 
    // ==========================================================================
-   // Beginning of Signal translation for F007_TH weather sensors (plugin 036)
-   // Data is manchester encoded and sent 3 times in a row, with no transition
-   // The long final pulse (6990 us) is truncated by the buffer size. 
-   // ==========================================================================
-
-   #define PULSE600 600 / RAWSIGNAL_SAMPLE_RATE
-   #define PULSE700 700 / RAWSIGNAL_SAMPLE_RATE
-
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {  
-      for (int i=1 ; i<25 ; i++)
-      {
-         if ( (i <= 19) && (RawSignal.Pulses[i]) > PULSE600 )
-            break;
-         if ( (i >= 20) && (RawSignal.Pulses[i]) < PULSE700 )
-            break;
-         RawSignal.Number = 111;       // New packet length, (too) long enough to handle at least one third of the pulses
-         return false;
-      }
-   }
-
-   // ==========================================================================
-   // Beginning of Signal translation for Atlantic/Visonic alarm detectors
-   // 74 pulses sent 1, 4 or 5 times. Pulse 74 = 3968 (064)
-   // ==========================================================================
-   // ==========================================================================
-   // Also Beginning of Signal translation for Auriol & Xiro (046)
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (int offset = 0; offset < 74; offset++)
-      {
-         if (RawSignal.Pulses[offset + 74] > PULSE3300 && RawSignal.Pulses[offset + 74 * 2] > PULSE3300 && ((offset > 0 && RawSignal.Pulses[offset] > PULSE3300) || RawSignal.Pulses[offset + 74 * 3] > PULSE3300))
-         {
-            for (i = 0; i < 74; i++)
-            {
-               RawSignal.Pulses[1 + i] = RawSignal.Pulses[offset + i + 1]; // reorder pulse array
-            }
-            RawSignal.Number = 74; // New packet length
-            // RawSignal.Pulses[0] = 46; // signal the plugin number that should process this packet, unused for Auriol/Xiron
-            // RawSignal.Pulses[0] = 64; // signal the plugin number that should process this packet, unused for Atlantic/Visonic
-            return false;  // Conversion done, stop plugin 1 and continue with regular plugins
-         }
-      }
-   }
+   // Atlantic/Visonic (064), Auriol v2 & Xiron (046), SelectPlus (070), Byron (072):
+   // repeat bursts are split in frames by Segment_Split() before reaching the plugins.
+   // F007_TH (036) copies have no gap in between, the plugin decodes the first one of the full buffer.
    // ==========================================================================
 
    // ==========================================================================
    // Beginning of Signal translation for Silvercrest Doorbell
    // ==========================================================================
-   // if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
+   // if (RawSignal->Number == RAW_BUFFER_SIZE - 1)
    // {
    //    for (j = 2; j < 114; j++)
    //    { // Only check twice the total RF packet length we are looking for
-   //       if (RawSignal.Pulses[j] > PULSE1100)
+   //       if (RawSignal->Pulses[j] > PULSE1100)
    //       { // input is going to fast skip to where new part is going to start
    //          if (j + 114 > RAW_BUFFER_SIZE - 1)
    //             break; // cant be the packet we look for
-   //          if ((RawSignal.Pulses[j + 114] > PULSE1100) && (RawSignal.Pulses[j + 114 + 114] > PULSE1100) && (RawSignal.Pulses[j + 114 + 114 + 114] > PULSE1100))
+   //          if ((RawSignal->Pulses[j + 114] > PULSE1100) && (RawSignal->Pulses[j + 114 + 114] > PULSE1100) && (RawSignal->Pulses[j + 114 + 114 + 114] > PULSE1100))
    //          { // first long delay found, make sure we have another at the right position
    //             for (i = 0; i < 114; i++)
    //             {
-   //                RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
+   //                RawSignal->Pulses[1 + i] = RawSignal->Pulses[j + 1 + i]; // reorder pulse array
    //             }
-   //             RawSignal.Number = 114;   // New packet length
-   //             RawSignal.Pulses[0] = 75; // signal the plugin number that should process this packet
+   //             RawSignal->Number = 114;   // New packet length
+   //             RawSignal->Pulses[0] = 75; // signal the plugin number that should process this packet
    //             return false;             // Conversion done, stop plugin 1 and continue with regular plugins
    //          }
    //       }
@@ -520,39 +493,39 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Home Confort Switches/Remotes
    // ==========================================================================
-   // if (RawSignal.Number > 299)
+   // if (RawSignal->Number > 299)
    // { // Scan for corrupted/chained Home Confort RF packets
-   //    if (RawSignal.Pulses[1] > PULSE2000)
+   //    if (RawSignal->Pulses[1] > PULSE2000)
    //    {
-   //       if (RawSignal.Pulses[100] > PULSE4000)
+   //       if (RawSignal->Pulses[100] > PULSE4000)
    //       {
-   //          if (RawSignal.Pulses[101] > PULSE2000)
+   //          if (RawSignal->Pulses[101] > PULSE2000)
    //          {
-   //             RawSignal.Number = 100;   // New packet length
-   //             RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
+   //             RawSignal->Number = 100;   // New packet length
+   //             RawSignal->Pulses[0] = 11; // signal the plugin number that should process this packet
    //             return false;             // packet detected, conversion done
    //          }
    //       }
    //    }
    //    for (j = 1; j < 104; j++)
    //    {
-   //       //if (RawSignal.Pulses[j]*RawSignal.Multiply > 4000) {
-   //       if (RawSignal.Pulses[j] > PULSE4000)
+   //       //if (RawSignal->Pulses[j]*RawSignal->Multiply > 4000) {
+   //       if (RawSignal->Pulses[j] > PULSE4000)
    //       {
-   //          //if (RawSignal.Pulses[j+1]*RawSignal.Multiply > 2000) {
-   //          if (RawSignal.Pulses[j + 1] > PULSE2000)
+   //          //if (RawSignal->Pulses[j+1]*RawSignal->Multiply > 2000) {
+   //          if (RawSignal->Pulses[j + 1] > PULSE2000)
    //          {
-   //             if ((j + 98) > RawSignal.Number)
+   //             if ((j + 98) > RawSignal->Number)
    //                break; // cant be the packet we are looking for
-   //             //if ( (RawSignal.Pulses[j+100]*RawSignal.Multiply > 4000) && (RawSignal.Pulses[j+101]*RawSignal.Multiply > 2000) ) { // This could be a Home Confort packet
-   //             if ((RawSignal.Pulses[j + 100] > PULSE4000) && (RawSignal.Pulses[j + 101] > PULSE2000))
+   //             //if ( (RawSignal->Pulses[j+100]*RawSignal->Multiply > 4000) && (RawSignal->Pulses[j+101]*RawSignal->Multiply > 2000) ) { // This could be a Home Confort packet
+   //             if ((RawSignal->Pulses[j + 100] > PULSE4000) && (RawSignal->Pulses[j + 101] > PULSE2000))
    //             { // This could be a Home Confort packet
    //                for (i = 0; i < 100; i++)
    //                {
-   //                   RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + i]; // relocate/reorder pulse array
+   //                   RawSignal->Pulses[1 + i] = RawSignal->Pulses[j + i]; // relocate/reorder pulse array
    //                }
-   //                RawSignal.Number = 100;   // New packet length
-   //                RawSignal.Pulses[0] = 11; // signal the plugin number that should process this packet
+   //                RawSignal->Number = 100;   // New packet length
+   //                RawSignal->Pulses[0] = 11; // signal the plugin number that should process this packet
    //             }
    //             return false; // Conversion done, stop plugin 1 and continue with regular plugins
    //          }
@@ -564,27 +537,27 @@ boolean Plugin_001(byte function, char *string)
    // ==========================================================================
    // Beginning of Signal translation for Oregon
    // ==========================================================================
-   // if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
+   // if (RawSignal->Number == RAW_BUFFER_SIZE - 1)
    // {
    //    for (j = 50; j < 104; j++)
    //    { // Only check the total RF packet length we are looking for
-   //       if (RawSignal.Pulses[j] > PULSE1600)
+   //       if (RawSignal->Pulses[j] > PULSE1600)
    //       { // input is going to fast skip to where new part is going to start
    //          if (j + 52 > RAW_BUFFER_SIZE - 1)
    //             break; // check for overflow, cant be the packet we look for
    //          byte x = 0;
-   //          if ((RawSignal.Pulses[j + 52] > PULSE1600) && (RawSignal.Pulses[j + 52 + 52] > PULSE1600) && (RawSignal.Pulses[j + 52 + 52 + 52] > PULSE1600))
+   //          if ((RawSignal->Pulses[j + 52] > PULSE1600) && (RawSignal->Pulses[j + 52 + 52] > PULSE1600) && (RawSignal->Pulses[j + 52 + 52 + 52] > PULSE1600))
    //             x = 2;
-   //          if ((RawSignal.Pulses[j + 50] > PULSE1600) && (RawSignal.Pulses[j + 50 + 50] > PULSE1600) && (RawSignal.Pulses[j + 50 + 50 + 50] > PULSE1600))
+   //          if ((RawSignal->Pulses[j + 50] > PULSE1600) && (RawSignal->Pulses[j + 50 + 50] > PULSE1600) && (RawSignal->Pulses[j + 50 + 50 + 50] > PULSE1600))
    //             x = 1;
    //          if (x != 0)
    //          {
    //             for (i = 0; i < 52; i++)
    //             {
-   //                RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
+   //                RawSignal->Pulses[1 + i] = RawSignal->Pulses[j + 1 + i]; // reorder pulse array
    //             }
-   //             RawSignal.Number = 52;    // New packet length
-   //             RawSignal.Pulses[0] = 63; // signal the plugin number that should process this packet
+   //             RawSignal->Number = 52;    // New packet length
+   //             RawSignal->Pulses[0] = 63; // signal the plugin number that should process this packet
    //             return false;             // Conversion done, stop plugin 1 and continue with regular plugins
    //          }
    //       }
@@ -592,70 +565,12 @@ boolean Plugin_001(byte function, char *string)
    // }
    // ==========================================================================
    // ==========================================================================
-   // Beginning of Signal translation for SelectPlus
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (j = 2; j < 37; j++)
-      { // Only check the total RF packet length we are looking for
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE5000)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 36 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 36] > PULSE5000) && (RawSignal.Pulses[j + 36 + 36] > PULSE5000))
-            { // first long delay found, make sure we have another at the right position
-               if (j != 36)
-               {
-                  for (i = 0; i < 36; i++)
-                  {
-                     RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-                  }
-               }
-               RawSignal.Number = 36;    // New packet length
-               RawSignal.Pulses[0] = 70; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
-   // ==========================================================================
-   // Beginning of Signal translation for Byron Doorbell
-   // ==========================================================================
-   if (RawSignal.Number == RAW_BUFFER_SIZE - 1)
-   {
-      for (j = 2; j < 90 /*RawSignal.Number*/; j++)
-      { // Only check twice the total RF packet length we are looking for
-         // Byron SX
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE2500)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 26 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 26] > PULSE2500) && (RawSignal.Pulses[j + 26] < PULSE3000) && (RawSignal.Pulses[j + 26 + 26] > PULSE2500))
-            { // first long delay found, make sure we have another at the right position
-               for (i = 0; i < 26; i++)
-               {
-                  RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-               }
-               RawSignal.Number = 26;    // New packet length
-               RawSignal.Pulses[0] = 72; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
 
    // ==========================================================================
    // End of Signal translation
    // ==========================================================================
-   if (RawSignal.Number > OVERSIZED_LIMIT)
+   if (RawSignal->Number > OVERSIZED_LIMIT)
    {                        // unknown and unsupported long packet (290 is the max. pulse length used at the Oregon plugin)
-      RawSignal.Number = 0; // no need to show this to any of the other plugins for processing
       return true;          // abort processing completely
    }                        // as there is no support for it anyway
    return false;
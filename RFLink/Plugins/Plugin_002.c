@@ -70,6 +70,8 @@
   \*********************************************************************************************/
 #define LACROSSE_PLUGIN_ID 002
 #define PLUGIN_DESC_002 "LaCrosse V2"
+#define PLUGIN_PULSES_002 {LACROSSE_PULSECOUNT - 2, LACROSSE_PULSECOUNT - 2}, \
+    {LACROSSE_PULSECOUNT, LACROSSE_PULSECOUNT}
 #define LACROSSE_PULSECOUNT 104 // also handles 102 pulses!
 
 #define LACROSSE_MIDLO 1100 / RAWSIGNAL_SAMPLE_RATE
@@ -79,10 +81,11 @@
 
 #ifdef PLUGIN_002
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_002(byte function, char *string)
+boolean Plugin_002(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number != LACROSSE_PULSECOUNT) && (RawSignal.Number != (LACROSSE_PULSECOUNT - 2)))
+   if ((RawSignal->Number != LACROSSE_PULSECOUNT) && (RawSignal->Number != (LACROSSE_PULSECOUNT - 2)))
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 5x4=20 bits
@@ -100,14 +103,14 @@ boolean Plugin_002(byte function, char *string)
    //==================================================================================
    // Get all 52 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number + 1; x += 2)
+   for (byte x = 1; x < RawSignal->Number + 1; x += 2)
    {
-      if ((RawSignal.Pulses[x + 1] < LACROSSE_MIDLO) || (RawSignal.Pulses[x + 1] > LACROSSE_MIDHI))
+      if ((RawSignal->Pulses[x + 1] < LACROSSE_MIDLO) || (RawSignal->Pulses[x + 1] > LACROSSE_MIDHI))
       {
-         if ((x + 1) < RawSignal.Number) // in between pulse check
+         if ((x + 1) < RawSignal->Number) // in between pulse check
             return false;
       }
-      if (RawSignal.Pulses[x] > LACROSSE_PULSEMID)
+      if (RawSignal->Pulses[x] > LACROSSE_PULSEMID)
       {
          if (bitcounter < 20)
          {
@@ -132,7 +135,7 @@ boolean Plugin_002(byte function, char *string)
          }
       }
    }
-   if (RawSignal.Number == (LACROSSE_PULSECOUNT - 2))
+   if (RawSignal->Number == (LACROSSE_PULSECOUNT - 2))
       bitstream2 <<= 1; // add missing zero bit
    //==================================================================================
    // all bytes received, sort data, do sanity checks and make sure checksum is okay
@@ -173,9 +176,7 @@ boolean Plugin_002(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[12]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently, save value for later
-   else
+   if (Repeat_Seen(PLUGIN_ID(002), tmpval, 250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -285,8 +286,7 @@ boolean Plugin_002(byte function, char *string)
       //return false;
    }
    //==================================================================================
-   RawSignal.Repeats = false;
-   RawSignal.Number = 0;
+   PluginResult.Quiet_ms = 0; // No quiet window
    return true;
 }
 #endif // PLUGIN_002
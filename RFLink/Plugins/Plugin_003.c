@@ -218,22 +218,24 @@
  \*********************************************************************************************/
 #define KAKU_PLUGIN_ID 003
 #define PLUGIN_DESC_003 "Kaku / AB400D / Impuls / PT2262 / Sartano / Tristate"
+#define PLUGIN_PULSES_003 {(KAKU_CodeLength * 4) + 2, (KAKU_CodeLength * 4) + 2}
 #define KAKU_CodeLength 12                        // number of data bits
 #define KAKU_R 300 / RAWSIGNAL_SAMPLE_RATE        //360 // 300          // 370? 350 us
 #define KAKU_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE // (17)  510 = KAKU_R*2 not sufficient!
 
 #ifdef PLUGIN_003
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_003(byte function, char *string)
+boolean Plugin_003(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != (KAKU_CodeLength * 4) + 2)
+   if (RawSignal->Number != (KAKU_CodeLength * 4) + 2)
       return false; // conventionele KAKU bestaat altijd uit 12 data bits plus stop. Ongelijk, dan geen KAKU!
-   if (RawSignal.Pulses[0] == 15)
+   if (RawSignal->Pulses[0] == 15)
       return true; // Home Easy, skip KAKU
-   if (RawSignal.Pulses[0] == 63)
+   if (RawSignal->Pulses[0] == 63)
       return false; // No need to test, packet for plugin 63
-   if (RawSignal.Pulses[0] == 19)
+   if (RawSignal->Pulses[0] == 19)
       return false; // No need to test, packet for plugin 19
    // -------------------------------------------
    int i, j;
@@ -258,24 +260,23 @@ boolean Plugin_003(byte function, char *string)
    // ==========================================================================
    j = KAKU_PULSEMID; // set MID value
    j--;
-   if (RawSignal.Pulses[0] == 33)
+   if (RawSignal->Pulses[0] == 33)
    {                           // If device is "Impuls"
-      RawSignal.Pulses[0] = 0; // Unset Impuls conversion indicator
       j = KAKU_R;              // Set new (LOWER!) MID value
       devicetype = 5;          // Indicate Impuls device
    }
    // -------------------------------------------
-   if (RawSignal.Pulses[49] > j)
+   if (RawSignal->Pulses[49] > j)
       return false; // Last pulse has to be low! Otherwise we are not dealing with an ARC signal
    // ==========================================================================
    // TIMING MEASUREMENT, this will find the shortest and longest pulse within the RF packet
    // ==========================================================================
-   for (i = 2; i < RawSignal.Number; i++) // skip first pulse as it is often affected by the start bit pulse duration
+   for (i = 2; i < RawSignal->Number; i++) // skip first pulse as it is often affected by the start bit pulse duration
    {
-      if (RawSignal.Pulses[i] < PTLow)       // shortest pulse?
-         PTLow = RawSignal.Pulses[i];        // new value
-      else if (RawSignal.Pulses[i] > PTHigh) // longest pulse?
-         PTHigh = RawSignal.Pulses[i];       // new value
+      if (RawSignal->Pulses[i] < PTLow)       // shortest pulse?
+         PTLow = RawSignal->Pulses[i];        // new value
+      else if (RawSignal->Pulses[i] > PTHigh) // longest pulse?
+         PTHigh = RawSignal->Pulses[i];       // new value
    }
    // -------------------------------------------
    // TIMING MEASUREMENT to devicetype
@@ -305,13 +306,13 @@ boolean Plugin_003(byte function, char *string)
    // -------------------------------------------
    for (i = 0; i < KAKU_CodeLength; i++)
    {
-      if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+      if (RawSignal->Pulses[4 * i + 1] < j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] < j && RawSignal->Pulses[4 * i + 4] > j)
       {                                  // 0101
          bitstream = (bitstream >> 1);   // bit '0'
          bitstream2 = (bitstream2 << 2); // bit '0' written as '00'
          signaltype = signaltype | 1;    // bit '0' present in signal '0001'
       }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+      else if (RawSignal->Pulses[4 * i + 1] < j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] > j && RawSignal->Pulses[4 * i + 4] < j)
       {              // 0110
                      //!! untested !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
          tricount++; // tri-state bit counter
@@ -328,13 +329,13 @@ boolean Plugin_003(byte function, char *string)
             signaltype = signaltype | 2;                                 // bit 'f' present in signal '0010'
          }
       }
-      else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] < j)
+      else if (RawSignal->Pulses[4 * i + 1] < j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] < j && RawSignal->Pulses[4 * i + 4] < j)
       {                                      // 0100
          bitstream = (bitstream >> 1);       // Short 0, Group command on 2nd bit.  (NOT USED?!)
          bitstream2 = (bitstream2 << 2) | 3; // bit 'short' written as '11'
          group = 1;
       }
-      else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+      else if (RawSignal->Pulses[4 * i + 1] > j && RawSignal->Pulses[4 * i + 2] < j && RawSignal->Pulses[4 * i + 3] > j && RawSignal->Pulses[4 * i + 4] < j)
       {                                      // 1010
          bitstream2 = (bitstream2 << 2) | 1; // bit '1' written as '01'
          signaltype = signaltype | 4;        // bit '1' present in signal '0100'
@@ -363,7 +364,7 @@ boolean Plugin_003(byte function, char *string)
          if (i == 0)
          {                                  // are we dealing with a RTK/AB600 device? then the first bit is sometimes mistakenly seen as 1101
             bitstream2 = (bitstream2 << 2); // bit 0
-            if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+            if (RawSignal->Pulses[4 * i + 1] > j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] < j && RawSignal->Pulses[4 * i + 4] > j)
             {                                // 1101
                bitstream = (bitstream >> 1); // 0, treat as 0101 eg 0 bit
             }
@@ -399,36 +400,14 @@ boolean Plugin_003(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   //if( (SignalHash!=SignalHashPrevious) || ((RepeatingTimer+500)<millis()) ) {
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2)))
-   {
-      // not seen the RF packet recently
-      if (signaltype == 0x07)
-      {
-         if (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2))
-         {
-            return true; // skip tristate after normal arc
-         }
-      }
-      //Serial.print("KAKU PREV:");
-      //Serial.println(SignalHashPrevious);
-      if ((SignalHashPrevious == 14) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 14;
-         return true; // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      }
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-      SignalCRC = bitstream2; // store RF packet identifier
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if ((signaltype == 0x07) && Repeat_Recent(PLUGIN_ID(003), 1250))
+      return true; // skip tristate after normal arc
+   if (Repeat_Recent(PLUGIN_ID(015), 2250))
+      return true; // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (Repeat_Recent(PLUGIN_ID(012), 2250))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
+   if (Repeat_Seen(PLUGIN_ID(003), bitstream2, 750))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Determine signal type to sort out the various houdecode/unitcode/button bits and on/off command bits
    //==================================================================================
@@ -609,8 +588,7 @@ boolean Plugin_003(byte function, char *string)
    display_Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_003
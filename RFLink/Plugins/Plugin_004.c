@@ -45,19 +45,22 @@
  \*********************************************************************************************/
 #define NewKAKU_PLUGIN_ID 004
 #define PLUGIN_DESC_004 "NewKaku"
+#define PLUGIN_PULSES_004 {NewKAKU_RawSignalLength, NewKAKU_RawSignalLength}, \
+    {NewKAKUdim_RawSignalLength, NewKAKUdim_RawSignalLength}
 #define NewKAKU_RawSignalLength 132            // regular KAKU packet length
 #define NewKAKUdim_RawSignalLength 148         // KAKU packet length including DIM bits
 #define NewKAKU_mT 650 / RAWSIGNAL_SAMPLE_RATE // us, approx. in between 1T and 4T
 
 #ifdef PLUGIN_004
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_004(byte function, char *string)
+boolean Plugin_004(byte function, const RawSignalStruct *RawSignal)
 {
    // nieuwe KAKU bestaat altijd uit start bit + 32 bits + evt 4 dim bits. Ongelijk, dan geen NewKAKU
-   if ((RawSignal.Number != NewKAKU_RawSignalLength) && (RawSignal.Number != NewKAKUdim_RawSignalLength))
+   if ((RawSignal->Number != NewKAKU_RawSignalLength) && (RawSignal->Number != NewKAKUdim_RawSignalLength))
       return false;
-   if (RawSignal.Pulses[0] == 15)
+   if (RawSignal->Pulses[0] == 15)
       return true; // Home Easy, skip KAKU
    boolean Bit = 0;
    int i;
@@ -67,15 +70,15 @@ boolean Plugin_004(byte function, char *string)
    byte dimbitpresent = 0;
    unsigned long bitstream = 0L;
 
-   // RawSignal.Pulses[1] startbit with duration of 1T => ignore
-   // RawSignal.Pulses[2] long space after startbit with duration of 8T => ignore
-   i = 3; // RawSignal.Pulses[3] is first pulse of a T,xT,T,xT combination
+   // RawSignal->Pulses[1] startbit with duration of 1T => ignore
+   // RawSignal->Pulses[2] long space after startbit with duration of 8T => ignore
+   i = 3; // RawSignal->Pulses[3] is first pulse of a T,xT,T,xT combination
    do
    {
-      P0 = RawSignal.Pulses[i];     // * RawSignal.Multiply;
-      P1 = RawSignal.Pulses[i + 1]; // * RawSignal.Multiply;
-      P2 = RawSignal.Pulses[i + 2]; // * RawSignal.Multiply;
-      P3 = RawSignal.Pulses[i + 3]; // * RawSignal.Multiply;
+      P0 = RawSignal->Pulses[i];     // * RawSignal->Multiply;
+      P1 = RawSignal->Pulses[i + 1]; // * RawSignal->Multiply;
+      P2 = RawSignal->Pulses[i + 2]; // * RawSignal->Multiply;
+      P3 = RawSignal->Pulses[i + 3]; // * RawSignal->Multiply;
 
       if (P0 < NewKAKU_mT && P1 < NewKAKU_mT && P2 < NewKAKU_mT && P3 > NewKAKU_mT)
       {
@@ -88,7 +91,7 @@ boolean Plugin_004(byte function, char *string)
       else if (P0 < NewKAKU_mT && P1 < NewKAKU_mT && P2 < NewKAKU_mT && P3 < NewKAKU_mT)
       { // T,T,T,T should be on i=111 (bit 28)
          dimbitpresent = 1;
-         if (RawSignal.Number != NewKAKUdim_RawSignalLength)
+         if (RawSignal->Number != NewKAKUdim_RawSignalLength)
          { // dim set but no dim bits present => invalid signal
             return false;
          }
@@ -107,26 +110,15 @@ boolean Plugin_004(byte function, char *string)
          dim = (dim << 1) | Bit;
       }
       i += 4;                          // Next 4 pulses
-   } while (i < RawSignal.Number - 2); //-2 to exclude the stopbit space/pulse
+   } while (i < RawSignal->Number - 2); //-2 to exclude the stopbit space/pulse
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 700) < millis()) || (SignalCRC != bitstream))
-   { // 1000
-      // not seen the RF packet recently
-      //if ((SignalHashPrevious==14) && ((RepeatingTimer+2000)>millis()) ) {
-      //   SignalHash=14;
-      //   return true;                            // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      //}
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-
-      SignalCRC = bitstream;
-   }
-   else
+   //if (Repeat_Recent(PLUGIN_ID(015), 2250))
+   //   return true;                            // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (Repeat_Recent(PLUGIN_ID(012), 2250))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
+   if (Repeat_Seen(PLUGIN_ID(004), bitstream, 950))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -144,8 +136,7 @@ boolean Plugin_004(byte function, char *string)
       display_CMD((CMD_Group)((bitstream >> 5) & B01), (CMD_OnOff)((bitstream >> 4) & B01)); // #ALL , #ON
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_004
@@ -40,6 +40,7 @@
  \*********************************************************************************************/
 #define EURODOMEST_PLUGIN_ID 005
 #define PLUGIN_DESC_005 "Eurodomest"
+#define PLUGIN_PULSES_005 {EURODOMEST_PulseLength, EURODOMEST_PulseLength}
 #define EURODOMEST_PulseLength 50
 
 #define EURODOMEST_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
@@ -48,12 +49,13 @@
 
 #ifdef PLUGIN_005
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_005(byte function, char *string)
+boolean Plugin_005(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != EURODOMEST_PulseLength)
+   if (RawSignal->Number != EURODOMEST_PulseLength)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (RawSignal->Pulses[0] == 63)
       return false; // No need to test, packet for plugin 63
 
    unsigned long bitstream = 0;
@@ -63,7 +65,7 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[49] > EURODOMEST_PULSEMID)
+   if (RawSignal->Pulses[49] > EURODOMEST_PULSEMID)
       return false; // last pulse needs to be short, otherwise no Eurodomest protocol
    //==================================================================================
    // Get all 24 bits
@@ -71,19 +73,19 @@ boolean Plugin_005(byte function, char *string)
    for (int x = 2; x < EURODOMEST_PulseLength; x += 2)
    {
       bitstream <<= 1; //Always shift
-      if (RawSignal.Pulses[x] > EURODOMEST_PULSEMID)
+      if (RawSignal->Pulses[x] > EURODOMEST_PULSEMID)
       { // long pulse
-         if (RawSignal.Pulses[x - 1] > EURODOMEST_PULSEMID)
+         if (RawSignal->Pulses[x - 1] > EURODOMEST_PULSEMID)
             return false; // not a 01 or 10 transmission
-         if (RawSignal.Pulses[x] > EURODOMEST_PULSEMAX)
+         if (RawSignal->Pulses[x] > EURODOMEST_PULSEMAX)
             return false; // make sure the long pulse is within range
          bitstream |= 0x1;
       }
       else
       { // short pulse
-         if (RawSignal.Pulses[x] < EURODOMEST_PULSEMIN)
+         if (RawSignal->Pulses[x] < EURODOMEST_PULSEMIN)
             return false; // pulse too short to be Eurodomest
-         if (RawSignal.Pulses[x - 1] < EURODOMEST_PULSEMID)
+         if (RawSignal->Pulses[x - 1] < EURODOMEST_PULSEMID)
             return false; // not a 01 or 10 transmission
          // bitstream |= 0x0;
       }
@@ -97,9 +99,7 @@ boolean Plugin_005(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(005), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform more sanity checks to prevent false positives
@@ -135,8 +135,7 @@ boolean Plugin_005(byte function, char *string)
    display_Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_005
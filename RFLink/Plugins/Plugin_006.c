@@ -37,15 +37,17 @@
  \*********************************************************************************************/
 #define BLYSS_PLUGIN_ID 006
 #define PLUGIN_DESC_006 "Blyss / Avidsen"
+#define PLUGIN_PULSES_006 {BLYSS_PULSECOUNT, BLYSS_PULSECOUNT}
 #define BLYSS_PULSECOUNT 106
 #define BLYSS_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_006
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_006(byte function, char *string)
+boolean Plugin_006(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != BLYSS_PULSECOUNT)
+   if (RawSignal->Number != BLYSS_PULSECOUNT)
       return false;
    unsigned long bitstream = 0L;
    unsigned long bitstream1 = 0L;
@@ -57,7 +59,7 @@ boolean Plugin_006(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x < BLYSS_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x] > BLYSS_PULSEMID)
+      if (RawSignal->Pulses[x] > BLYSS_PULSEMID)
       {
          if (bitcounter < 32)
          {
@@ -95,9 +97,7 @@ boolean Plugin_006(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(006), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    byte status = ((bitstream1) >> 16) & 0x0f;
@@ -144,8 +144,7 @@ boolean Plugin_006(byte function, char *string)
    display_CMD((status >> 1) & B01, !(status & B01)); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_006
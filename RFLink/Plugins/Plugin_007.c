@@ -44,16 +44,19 @@
  \*********************************************************************************************/
 #define CONRADRSL2_PLUGIN_ID 007
 #define PLUGIN_DESC_007 "Conrad"
+#define PLUGIN_PULSES_007 {CONRADRSL2_PULSECOUNT, CONRADRSL2_PULSECOUNT}, \
+    {CONRADRSL2_PULSECOUNT + 2, CONRADRSL2_PULSECOUNT + 2}
 #define CONRADRSL2_PULSECOUNT 66
 
 #define CONRADRSL2_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_007
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_007(byte function, char *string)
+boolean Plugin_007(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number != CONRADRSL2_PULSECOUNT) && (RawSignal.Number != CONRADRSL2_PULSECOUNT + 2))
+   if ((RawSignal->Number != CONRADRSL2_PULSECOUNT) && (RawSignal->Number != CONRADRSL2_PULSECOUNT + 2))
       return false;
    unsigned long bitstream = 0L;
    byte checksum = 0;
@@ -62,24 +65,24 @@ boolean Plugin_007(byte function, char *string)
    byte group = 0;
    byte action = 0;
    byte start = 0;
-   if (RawSignal.Number == CONRADRSL2_PULSECOUNT + 2)
+   if (RawSignal->Number == CONRADRSL2_PULSECOUNT + 2)
       start = 2;
    //==================================================================================
    // Get all 32 bits
    //==================================================================================
-   for (byte x = 1 + start; x < RawSignal.Number - 2; x += 2)
+   for (byte x = 1 + start; x < RawSignal->Number - 2; x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > CONRADRSL2_PULSEMID)
+      if (RawSignal->Pulses[x] > CONRADRSL2_PULSEMID)
       {
-         if (RawSignal.Pulses[x + 1] > CONRADRSL2_PULSEMID)
+         if (RawSignal->Pulses[x + 1] > CONRADRSL2_PULSEMID)
             return false; // manchester check
 
          bitstream |= 0x1; // 1
       }
       else
       {
-         if (RawSignal.Pulses[x + 1] < CONRADRSL2_PULSEMID)
+         if (RawSignal->Pulses[x + 1] < CONRADRSL2_PULSEMID)
             return false; // manchester check
 
          // bitstream |= 0x0; // 0
@@ -93,9 +96,7 @@ boolean Plugin_007(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(007), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // all bits received, make sure checksum is okay
@@ -231,8 +232,7 @@ boolean Plugin_007(byte function, char *string)
    display_CMD((group == 0x3), (action == 1)); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_007
@@ -33,16 +33,18 @@
  \*********************************************************************************************/
 #define KAMBROOK_PLUGIN_ID 008
 #define PLUGIN_DESC_008 "Kambrook"
+#define PLUGIN_PULSES_008 {KAMBROOK_PULSECOUNT, KAMBROOK_PULSECOUNT}
 #define KAMBROOK_PULSECOUNT 96
 
 #define KAMBROOK_PULSEMID 400 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_008
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_008(byte function, char *string)
+boolean Plugin_008(byte function, const RawSignalStruct *RawSignal)
 {
-    if (RawSignal.Number != KAMBROOK_PULSECOUNT)
+    if (RawSignal->Number != KAMBROOK_PULSECOUNT)
         return false;
 
     unsigned long address = 0L;
@@ -59,7 +61,7 @@ boolean Plugin_008(byte function, char *string)
     //==================================================================================
     for (byte x = 1; x < KAMBROOK_PULSECOUNT; x += 2)
     {
-        if (RawSignal.Pulses[x] > KAMBROOK_PULSEMID)
+        if (RawSignal->Pulses[x] > KAMBROOK_PULSEMID)
         {
             if (bitcounter < 8)
             {
@@ -115,11 +117,7 @@ boolean Plugin_008(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if (SignalHash != SignalHashPrevious || RepeatingTimer < millis())
-    {
-        // not seen the RF packet recently
-    }
-    else
+    if (Repeat_Seen(PLUGIN_ID(008), (address << 8) | command, 250))
         return true; // already seen the RF packet recently
     //==================================================================================
     //==================================================================================
@@ -145,8 +143,7 @@ boolean Plugin_008(byte function, char *string)
     display_CMD(CMD_Single, (status & B01)); // #ALL #ON
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;
+    PluginResult.Quiet = true; // suppress repeats of the same RF packet
     return true;
 }
 #endif // PLUGIN_008
@@ -45,16 +45,19 @@
  \*********************************************************************************************/
 #define X10_PLUGIN_ID 009
 #define PLUGIN_DESC_009 "X10"
+#define PLUGIN_PULSES_009 {X10_PulseLength, X10_PulseLength}, {X10_PulseLength + 2, X10_PulseLength + 2}
 #define X10_PulseLength 66
 
 #define X10_PULSEMID 600 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_009
+#include "../2_Classify.h"
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_009(byte function, char *string)
+boolean Plugin_009(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number != (X10_PulseLength)) && (RawSignal.Number != (X10_PulseLength + 2)))
+   if ((RawSignal->Number != (X10_PulseLength)) && (RawSignal->Number != (X10_PulseLength + 2)))
       return false;
    unsigned long bitstream = 0L;
    byte housecode = 0;
@@ -62,12 +65,13 @@ boolean Plugin_009(byte function, char *string)
    byte command = 0;
    byte data[4];
    byte start = 0;
+   byte split = Classify_Split(RawSignal, X10_PULSEMID);
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Number == X10_PulseLength + 2)
+   if (RawSignal->Number == X10_PulseLength + 2)
    {
-      if ((RawSignal.Pulses[1] * RawSignal.Multiply > 3000) && (RawSignal.Pulses[2] * RawSignal.Multiply > 3000))
+      if ((RawSignal->Pulses[1] * RawSignal->Multiply > 3000) && (RawSignal->Pulses[2] * RawSignal->Multiply > 3000))
          start = 2;
       else
          return false; // not an X10 packet
@@ -78,7 +82,7 @@ boolean Plugin_009(byte function, char *string)
    for (byte x = 2 + start; x < ((X10_PulseLength) + start); x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > X10_PULSEMID)
+      if (Classify_IsLong(RawSignal, x, split, X10_PULSEMID))
          bitstream |= 0x1;
       // else
       //    bitstream |= 0x0;
@@ -91,9 +95,7 @@ boolean Plugin_009(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(009), bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // order received data
@@ -280,8 +282,7 @@ boolean Plugin_009(byte function, char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_009
@@ -47,6 +47,7 @@
  \*********************************************************************************************/
 #define RGB_PLUGIN_ID 010
 #define PLUGIN_DESC_010 "TRC02RGB"
+#define PLUGIN_PULSES_010 {RGB_MIN_PULSECOUNT, RGB_MAX_PULSECOUNT}
 #define RGB_MIN_PULSECOUNT 180
 #define RGB_MAX_PULSECOUNT 186
 
@@ -60,9 +61,9 @@
 #ifdef PLUGIN_010
 #include "../4_Display.h"
 
-boolean Plugin_010(byte function, char *string)
+boolean Plugin_010(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number < RGB_MIN_PULSECOUNT || RawSignal.Number > RGB_MAX_PULSECOUNT)
+   if (RawSignal->Number < RGB_MIN_PULSECOUNT || RawSignal->Number > RGB_MAX_PULSECOUNT)
       return false;
    unsigned long bitstream = 0L; // holds first 32 bits
 
@@ -77,12 +78,12 @@ boolean Plugin_010(byte function, char *string)
    //==================================================================================
    // Get all 33 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number - 2; x++)
+   for (byte x = 1; x < RawSignal->Number - 2; x++)
    { // get bytes
       if (start_stop != 0x01)
       {
-         //if (RawSignal.Pulses[x]*RawSignal.Multiply > 1200 && RawSignal.Pulses[x]*RawSignal.Multiply < 1500) {
-         if (RawSignal.Pulses[x] > RGB_PULSE_STLO && RawSignal.Pulses[x] < RGB_PULSE_STHI)
+         //if (RawSignal->Pulses[x]*RawSignal->Multiply > 1200 && RawSignal->Pulses[x]*RawSignal->Multiply < 1500) {
+         if (RawSignal->Pulses[x] > RGB_PULSE_STLO && RawSignal->Pulses[x] < RGB_PULSE_STHI)
          {
             start_stop = 0x01;
             continue;
@@ -94,7 +95,7 @@ boolean Plugin_010(byte function, char *string)
             continue;
          }
       }
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 750 && RawSignal.Pulses[x] * RawSignal.Multiply < 1000)
+      if (RawSignal->Pulses[x] * RawSignal->Multiply > 750 && RawSignal->Pulses[x] * RawSignal->Multiply < 1000)
       {
          if (halfbit == 1) // cant receive a 1 bit after a single low value
             return false;  // pulse error, must not be a UPM packet or reception error
@@ -118,7 +119,7 @@ boolean Plugin_010(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 625 && RawSignal.Pulses[x] * RawSignal.Multiply < 250)
+         if (RawSignal->Pulses[x] * RawSignal->Multiply > 625 && RawSignal->Pulses[x] * RawSignal->Multiply < 250)
             return false; // Not a valid UPM pulse length
 
          if (halfbit == 0) // 2 times a low value = 0 bit
@@ -146,7 +147,7 @@ boolean Plugin_010(byte function, char *string)
    }
    //==================================================================================
    // Validity checks
-   if (RawSignal.Pulses[x + 2] * RawSignal.Multiply < 1200 || RawSignal.Pulses[x + 2] * RawSignal.Multiply > 1500)
+   if (RawSignal->Pulses[x + 2] * RawSignal->Multiply < 1200 || RawSignal->Pulses[x + 2] * RawSignal->Multiply > 1500)
       return false;
    //==================================================================================
    // perform a checksum check to make sure the packet is a valid RGB control packet
@@ -215,8 +216,7 @@ boolean Plugin_010(byte function, char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_010
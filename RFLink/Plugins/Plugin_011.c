@@ -56,16 +56,18 @@
  \*********************************************************************************************/
 #define HC_PLUGIN_ID 011
 #define PLUGIN_DESC_011 "HomeConfort"
+#define PLUGIN_PULSES_011 {HC_PULSECOUNT, HC_PULSECOUNT}
 #define HC_PULSECOUNT 100
 
 #ifdef PLUGIN_011
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_011(byte function, char *string)
+boolean Plugin_011(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != HC_PULSECOUNT)
+   if (RawSignal->Number != HC_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[1] * RawSignal.Multiply < 2000)
+   if (RawSignal->Pulses[1] * RawSignal->Multiply < 2000)
       return false; // First (start) pulse needs to be long
 
    unsigned long bitstream1 = 0; // holds first 24 bits
@@ -80,11 +82,11 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    for (int x = 2; x < HC_PULSECOUNT - 2; x += 2)
    { // get bytes
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 500)
+      if (RawSignal->Pulses[x] * RawSignal->Multiply > 500)
       { // long pulse
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 800)
+         if (RawSignal->Pulses[x] * RawSignal->Multiply > 800)
             return false; // Pulse range check
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 400)
+         if (RawSignal->Pulses[x + 1] * RawSignal->Multiply > 400)
             return false; // Manchester check
          if (bitcounter < 24)
          {
@@ -100,9 +102,9 @@ boolean Plugin_011(byte function, char *string)
       }
       else
       { // short pulse
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 300)
+         if (RawSignal->Pulses[x] * RawSignal->Multiply > 300)
             return false; // pulse range check
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 400)
+         if (RawSignal->Pulses[x + 1] * RawSignal->Multiply < 400)
             return false; // Manchester check
          if (bitcounter < 24)
          {
@@ -117,9 +119,9 @@ boolean Plugin_011(byte function, char *string)
       if (bitcounter > 50)
          break;
    }
-   if (RawSignal.Pulses[98] * RawSignal.Multiply > 300)
+   if (RawSignal->Pulses[98] * RawSignal->Multiply > 300)
       return false; // pulse range check, last two pulses should be short
-   if (RawSignal.Pulses[99] * RawSignal.Multiply > 300)
+   if (RawSignal->Pulses[99] * RawSignal->Multiply > 300)
       return false; // pulse range check
    //==================================================================================
    // first perform a check to make sure the packet is valid
@@ -135,9 +137,7 @@ boolean Plugin_011(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || ((RepeatingTimer + 500) < millis()) || SignalCRC != bitstream2)
-      SignalCRC = bitstream2; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(011), bitstream2, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the command / switch settings
@@ -169,8 +169,7 @@ boolean Plugin_011(byte function, char *string)
    display_CMD((group & B01), (command & B01)); // #ALL , #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_011
@@ -78,6 +78,7 @@
  \*********************************************************************************************/
 #define FA500_PLUGIN_ID 012
 #define PLUGIN_DESC_012 "FA500"
+#define PLUGIN_PULSES_012 {FA500RM3_PulseLength, FA500RM3_PulseLength}, {FA500RM1_PulseLength, FA500RM1_PulseLength}
 #define FA500RM3_PulseLength 26
 #define FA500RM1_PulseLength 58
 
@@ -86,9 +87,9 @@
 #ifdef PLUGIN_012
 #include "../4_Display.h"
 
-boolean Plugin_012(byte function, char *string)
+boolean Plugin_012(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != (FA500RM3_PulseLength) && RawSignal.Number != (FA500RM1_PulseLength))
+   if (RawSignal->Number != (FA500RM3_PulseLength) && RawSignal->Number != (FA500RM1_PulseLength))
       return false;
 
    byte type = 0; // 0=KAKU 1=ITK 2=PT2262
@@ -100,14 +101,14 @@ boolean Plugin_012(byte function, char *string)
    //==================================================================================
    // Get all 28 bits
    //==================================================================================
-   if (RawSignal.Number == (FA500RM3_PulseLength))
+   if (RawSignal->Number == (FA500RM3_PulseLength))
    {
       // get all 26pulses =>24 manchester bits => 12 actual bits
       type = 0;
       for (byte x = 2; x <= FA500RM3_PulseLength - 2; x += 2)
       {                   // Method 3
          bitstream <<= 1; // Always shift
-         if (RawSignal.Pulses[x] > FA500_PULSEMID)
+         if (RawSignal->Pulses[x] > FA500_PULSEMID)
             bitstream |= 0x1;
          // else
          //    bitstream |= 0x0;
@@ -120,7 +121,7 @@ boolean Plugin_012(byte function, char *string)
       for (byte x = 1; x <= FA500RM1_PulseLength - 2; x += 2)
       {                   // method 1
          bitstream <<= 1; // Always shift
-         if (RawSignal.Pulses[x] > FA500_PULSEMID)
+         if (RawSignal->Pulses[x] > FA500_PULSEMID)
             bitstream |= 0x1;
          // else
          //    bitstream |= 0x0;
@@ -175,11 +176,11 @@ boolean Plugin_012(byte function, char *string)
       }
       command = 2; // initialize to "unknown"
       // Trick: here we use the on/off command from the other packet type as it is not detected in the current packet, it was passed via Pluses[0] in plugin 1
-      if (RawSignal.Pulses[0] * RawSignal.Multiply > 1000 && RawSignal.Pulses[0] * RawSignal.Multiply < 1400)
+      if (RawSignal->Pulses[0] * RawSignal->Multiply > 1000 && RawSignal->Pulses[0] * RawSignal->Multiply < 1400)
       {
          command = 0;
       }
-      else if (RawSignal.Pulses[0] * RawSignal.Multiply > 100 && RawSignal.Pulses[0] * RawSignal.Multiply < 400)
+      else if (RawSignal->Pulses[0] * RawSignal->Multiply > 100 && RawSignal->Pulses[0] * RawSignal->Multiply < 400)
       {
          command = 1;
       }
@@ -231,7 +232,7 @@ boolean Plugin_012(byte function, char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_012
@@ -90,6 +90,7 @@
  \*********************************************************************************************/
 #define POWERFIX_PLUGIN_ID 013
 #define PLUGIN_DESC_013 "Powerfix"
+#define PLUGIN_PULSES_013 {POWERFIX_PulseLength, POWERFIX_PulseLength}
 #define POWERFIX_PulseLength 42
 
 #define POWEFIX_PULSEMID 900 / RAWSIGNAL_SAMPLE_RATE
@@ -98,10 +99,11 @@
 
 #ifdef PLUGIN_013
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_013(byte function, char *string)
+boolean Plugin_013(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != POWERFIX_PulseLength)
+   if (RawSignal->Number != POWERFIX_PulseLength)
       return false;
    unsigned long bitstream = 0L;
    unsigned int address = 0;
@@ -113,7 +115,7 @@ boolean Plugin_013(byte function, char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[1] > POWEFIX_PULSEMID)
+   if (RawSignal->Pulses[1] > POWEFIX_PULSEMID)
       return false; // start pulse must be short
    //==================================================================================
    // Get all 20 bits
@@ -121,11 +123,11 @@ boolean Plugin_013(byte function, char *string)
    for (byte x = 2; x < POWERFIX_PulseLength - 1; x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > POWEFIX_PULSEMID)
+      if (RawSignal->Pulses[x] > POWEFIX_PULSEMID)
       {
-         if (RawSignal.Pulses[x] > POWEFIX_PULSEMAX)
+         if (RawSignal->Pulses[x] > POWEFIX_PULSEMAX)
             return false; // Long pulse too long
-         if (RawSignal.Pulses[x + 1] > POWEFIX_PULSEMID)
+         if (RawSignal->Pulses[x + 1] > POWEFIX_PULSEMID)
             return false; // pulse sequence check 01/10
          bitstream |= 0x1;
          if (bitcount > 11)
@@ -133,9 +135,9 @@ boolean Plugin_013(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] < POWEFIX_PULSEMIN)
+         if (RawSignal->Pulses[x] < POWEFIX_PULSEMIN)
             return false; // Short pulse too short
-         if (RawSignal.Pulses[x + 1] < POWEFIX_PULSEMID)
+         if (RawSignal->Pulses[x + 1] < POWEFIX_PULSEMID)
             return false; // pulse sequence check 01/10
          // bitstream |= 0x0;
       }
@@ -151,9 +153,7 @@ boolean Plugin_013(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 1500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(013), bitstream, 1750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Sort data
@@ -203,8 +203,7 @@ boolean Plugin_013(byte function, char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 
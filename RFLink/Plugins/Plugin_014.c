@@ -35,6 +35,7 @@
  \*********************************************************************************************/
 #define KOPPLA_PLUGIN_ID 014
 #define PLUGIN_DESC_014 "Ikea Koppla"
+#define PLUGIN_PULSES_014 {KOPPLA_PulseLength_MIN, KOPPLA_PulseLength_MAX}
 #define KOPPLA_PulseLength_MIN 36
 #define KOPPLA_PulseLength_MAX 52
 
@@ -45,9 +46,9 @@
 #ifdef PLUGIN_014
 #include "../4_Display.h"
 
-boolean Plugin_014(byte function, char *string)
+boolean Plugin_014(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < KOPPLA_PulseLength_MIN) || (RawSignal.Number > KOPPLA_PulseLength_MAX))
+   if ((RawSignal->Number < KOPPLA_PulseLength_MIN) || (RawSignal->Number > KOPPLA_PulseLength_MAX))
       return false;
    unsigned long bitstream = 0L;
 
@@ -65,22 +66,22 @@ boolean Plugin_014(byte function, char *string)
    //==================================================================================
    // Get all 28 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number; x++)
+   for (byte x = 1; x < RawSignal->Number; x++)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > KOPPLA_PULSEMID)
+      if (RawSignal->Pulses[x] > KOPPLA_PULSEMID)
       { // long pulse, 0 bit
-         if (RawSignal.Pulses[x] > KOPPLA_PULSEMAX)
+         if (RawSignal->Pulses[x] > KOPPLA_PULSEMAX)
             return false; // long pulse is too long
          // bitstream |= 0x0; // 0 bit
       }
       else
       { // Short pulse
-         if (RawSignal.Pulses[x] < KOPPLA_PULSEMIN)
+         if (RawSignal->Pulses[x] < KOPPLA_PULSEMIN)
             return false; // short pulse is too short
-         if (RawSignal.Pulses[x + 1] > KOPPLA_PULSEMID)
+         if (RawSignal->Pulses[x + 1] > KOPPLA_PULSEMID)
             return false; // need 2 short pulses for a 1 bit
-         if (RawSignal.Pulses[x + 1] < KOPPLA_PULSEMIN)
+         if (RawSignal->Pulses[x + 1] < KOPPLA_PULSEMIN)
             return false;                    // second short pulse is too short
          x++;                                // skip second short pulse
          bitstream |= 0x1; // 1 bit
@@ -169,8 +170,7 @@ boolean Plugin_014(byte function, char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_014
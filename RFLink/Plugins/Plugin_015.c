@@ -49,16 +49,18 @@
  \*********************************************************************************************/
 #define HomeEasy_PLUGIN_ID 015
 #define PLUGIN_DESC_015 "HomeEasy"
+#define PLUGIN_PULSES_015 {HomeEasy_PulseLength, HomeEasy_PulseLength}
 #define HomeEasy_PulseLength 116
 
 #define HomeEasy_PULSEMID 500 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_015
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_015(byte function, char *string)
+boolean Plugin_015(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != HomeEasy_PulseLength)
+   if (RawSignal->Number != HomeEasy_PulseLength)
       return false;
    unsigned long preamble = 0L;
    unsigned long address = 0L;
@@ -69,7 +71,6 @@ boolean Plugin_015(byte function, char *string)
    byte channel = 0;
    byte type = 0;
    byte temp = 0;
-   RawSignal.Pulses[0] = 0; // undo any Home Easy to Kaku blocking that might be active
    //==================================================================================
    // Get all 58? bits
    //==================================================================================
@@ -78,7 +79,7 @@ boolean Plugin_015(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x <= HomeEasy_PulseLength; x = x + 2)
    {
-      if ((RawSignal.Pulses[x] < HomeEasy_PULSEMID) && (RawSignal.Pulses[x + 1] > HomeEasy_PULSEMID))
+      if ((RawSignal->Pulses[x] < HomeEasy_PULSEMID) && (RawSignal->Pulses[x + 1] > HomeEasy_PULSEMID))
          rfbit = 1;
       else
          rfbit = 0;
@@ -100,9 +101,7 @@ boolean Plugin_015(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(015), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    type = ((bitstream >> 12) & 0x3); // 11b for HE301
@@ -131,8 +130,7 @@ boolean Plugin_015(byte function, char *string)
    display_CMD((group & B01), (!(command & B01))); // #All #ON
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true;
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true;
    return true;
 }
 #endif // PLUGIN_015
@@ -51,6 +51,8 @@
  \*********************************************************************************************/
 #define DKW2012_PLUGIN_ID 029
 #define PLUGIN_DESC_029 "Alecto V2 / DKW2012"
+#define PLUGIN_PULSES_029 {ACH2010_MIN_PULSECOUNT, ACH2010_MAX_PULSECOUNT}, \
+    {DKW2012_MIN_PULSECOUNT, DKW2012_MAX_PULSECOUNT}
 
 #define ACH2010_MIN_PULSECOUNT 160 // reduce this value (144?) in case of bad reception
 #define ACH2010_MAX_PULSECOUNT 160
@@ -61,16 +63,17 @@
 
 #ifdef PLUGIN_029
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
 uint8_t Plugin_029_ProtocolAlectoCRC8(uint8_t *addr, uint8_t len);
 
-boolean Plugin_029(byte function, char *string)
+boolean Plugin_029(byte function, const RawSignalStruct *RawSignal)
 {
   if (!(
-          ((RawSignal.Number >= ACH2010_MIN_PULSECOUNT) &&
-           (RawSignal.Number <= ACH2010_MAX_PULSECOUNT)) ||
-          ((RawSignal.Number >= DKW2012_MIN_PULSECOUNT) &&
-           (RawSignal.Number <= DKW2012_MAX_PULSECOUNT))))
+          ((RawSignal->Number >= ACH2010_MIN_PULSECOUNT) &&
+           (RawSignal->Number <= ACH2010_MAX_PULSECOUNT)) ||
+          ((RawSignal->Number >= DKW2012_MIN_PULSECOUNT) &&
+           (RawSignal->Number <= DKW2012_MAX_PULSECOUNT))))
     return false;
 
   byte c = 0;
@@ -81,17 +84,17 @@ boolean Plugin_029(byte function, char *string)
   byte checksumcalc = 0;
   byte maxidx = 8;
   //==================================================================================
-  if (RawSignal.Number > ACH2010_MAX_PULSECOUNT)
+  if (RawSignal->Number > ACH2010_MAX_PULSECOUNT)
     maxidx = 9;
   byte idx = maxidx;
   //==================================================================================
   // Get all 8x11 bits
   //==================================================================================
   // Get message back to front as the header is almost never received complete for ACH2010
-  for (byte x = RawSignal.Number; x > 0; x -= 2)
+  for (byte x = RawSignal->Number; x > 0; x -= 2)
   {
     data[idx] >>= 1; // Always shift
-    if (RawSignal.Pulses[x - 1] < DKW2012_PULSEMINMAX)
+    if (RawSignal->Pulses[x - 1] < DKW2012_PULSEMINMAX)
       data[idx] |= 0x80;
     // else
     //  data[idx] |= 0x00;
@@ -121,9 +124,7 @@ boolean Plugin_029(byte function, char *string)
   //==================================================================================
   unsigned long tmpval = data[0] << 8 | data[1];
 
-  if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != tmpval))
-    SignalCRC = tmpval; // not seen the RF packet recently
-  else
+  if (Repeat_Seen(PLUGIN_ID(029), tmpval, 1250))
     return true; // already seen the RF packet recently
   //==================================================================================
   // Now process the various sensor types
@@ -145,7 +146,7 @@ boolean Plugin_029(byte function, char *string)
   wgust /= 20;
   rain = (data[6] << 8) | data[7];
   rain *= 3;
-  if (RawSignal.Number >= DKW2012_MIN_PULSECOUNT)
+  if (RawSignal->Number >= DKW2012_MIN_PULSECOUNT)
   {
     wdir = (data[8] & 0xF);
   }
@@ -153,7 +154,7 @@ boolean Plugin_029(byte function, char *string)
   // Output
   //==================================================================================
   display_Header();
-  if (RawSignal.Number >= DKW2012_MIN_PULSECOUNT)
+  if (RawSignal->Number >= DKW2012_MIN_PULSECOUNT)
     display_Name(PSTR("DKW2012"));
   else
     display_Name(PSTR("Alecto V2"));
@@ -163,13 +164,12 @@ boolean Plugin_029(byte function, char *string)
   display_WINSP(wspeed);
   display_WINGS(wgust);
   display_RAIN(rain);
-  if (RawSignal.Number >= DKW2012_MIN_PULSECOUNT)
+  if (RawSignal->Number >= DKW2012_MIN_PULSECOUNT)
     display_WINDIR(wdir);
   display_BAT(bat);
   display_Footer();
   //==================================================================================
-  RawSignal.Repeats = true; // suppress repeats of the same RF packet
-  RawSignal.Number = 0;     // do not process the packet any further
+  PluginResult.Quiet = true; // suppress repeats of the same RF packet
   return true;
 }
 
@@ -94,6 +94,7 @@
  \*********************************************************************************************/
 #define ALECTOV1_PLUGIN_ID 030
 #define PLUGIN_DESC_030 "Alecto V1"
+#define PLUGIN_PULSES_030 {ALECTOV1_PULSECOUNT, ALECTOV1_PULSECOUNT}
 #define ALECTOV1_PULSECOUNT 74
 
 #define ALECTOV1_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
@@ -101,10 +102,11 @@
 
 #ifdef PLUGIN_030
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_030(byte function, char *string)
+boolean Plugin_030(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != ALECTOV1_PULSECOUNT)
+   if (RawSignal->Number != ALECTOV1_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L;
@@ -124,19 +126,19 @@ boolean Plugin_030(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x <= 64; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] > ALECTOV1_MIDHI)
+      if (RawSignal->Pulses[x + 1] > ALECTOV1_MIDHI)
          return false; // in between pulses should be short
 
       bitstream >>= 1;
 
-      if (RawSignal.Pulses[x] > ALECTOV1_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > ALECTOV1_PULSEMAXMIN)
          bitstream |= (0x1L << 31); // Reverses order, as number are in LSB 1st, beware N2 and N3 !
    }
    for (byte x = 66; x <= 72; x = x + 2)
    {
       checksum >>= 1;
 
-      if (RawSignal.Pulses[x] > ALECTOV1_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > ALECTOV1_PULSEMAXMIN)
          checksum |= (0x1L << 3);
    }
    //==================================================================================
@@ -147,13 +149,8 @@ boolean Plugin_030(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-   {
-      SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   }
-   else
-      return true; // already seen the RF packet recently
+   if (Repeat_Seen(PLUGIN_ID(030), bitstream, 1250)) // Mixed message bursts keep one entry per message
+      return true;                                     // already seen the RF packet recently
    //==================================================================================
    // Prepare nibbles from bit stream
    //==================================================================================
@@ -221,8 +218,7 @@ boolean Plugin_030(byte function, char *string)
       display_BAT(battery);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
+      PluginResult.Quiet = true; // suppress repeats of the same RF packet
       return true;
    }
    else
@@ -263,8 +259,7 @@ boolean Plugin_030(byte function, char *string)
       display_BAT(battery);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
+      PluginResult.Quiet = true; // suppress repeats of the same RF packet
       return true;
    }
    return false;
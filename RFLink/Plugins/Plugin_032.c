@@ -41,6 +41,7 @@
  \*********************************************************************************************/
 #define ALECTOV4_PLUGIN_ID 032
 #define PLUGIN_DESC_032 "Alecto V4"
+#define PLUGIN_PULSES_032 {ALECTOV4_PULSECOUNT, ALECTOV4_PULSECOUNT + 4}
 #define ALECTOV4_PULSECOUNT 74
 
 #define ALECTOV4_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
@@ -50,10 +51,11 @@
 
 #ifdef PLUGIN_032
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_032(byte function, char *string)
+boolean Plugin_032(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number < ALECTOV4_PULSECOUNT || RawSignal.Number > (ALECTOV4_PULSECOUNT + 4))
+   if (RawSignal->Number < ALECTOV4_PULSECOUNT || RawSignal->Number > (ALECTOV4_PULSECOUNT + 4))
       return false;
 
    unsigned long bitstream = 0L;
@@ -65,24 +67,24 @@ boolean Plugin_032(byte function, char *string)
    // Get all 36 bits
    //==================================================================================
    byte start = 0;
-   if (RawSignal.Number == (ALECTOV4_PULSECOUNT + 4))
+   if (RawSignal->Number == (ALECTOV4_PULSECOUNT + 4))
       start = 4;
-   if (RawSignal.Number == (ALECTOV4_PULSECOUNT + 2))
+   if (RawSignal->Number == (ALECTOV4_PULSECOUNT + 2))
       start = 2;
 
    for (byte x = 2 + start; x <= 56 + start; x += 2)
    { // Get first 28 bits
-      if (RawSignal.Pulses[x + 1] > ALECTOV4_MIDHI)
+      if (RawSignal->Pulses[x + 1] > ALECTOV4_MIDHI)
          return false;
 
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > ALECTOV4_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > ALECTOV4_PULSEMAXMIN)
          bitstream |= 0x1;
       else
       {
-         if (RawSignal.Pulses[x] < ALECTOV4_PULSEMIN)
+         if (RawSignal->Pulses[x] < ALECTOV4_PULSEMIN)
             return false;
-         if (RawSignal.Pulses[x] > ALECTOV4_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > ALECTOV4_PULSEMINMAX)
             return false;
          // bitstream |= 0x0;
       }
@@ -90,17 +92,17 @@ boolean Plugin_032(byte function, char *string)
 
    for (byte x = 58 + start; x <= 72 + start; x = x + 2)
    { // Get remaining 8 bits
-      if (RawSignal.Pulses[x + 1] > ALECTOV4_MIDHI)
+      if (RawSignal->Pulses[x + 1] > ALECTOV4_MIDHI)
          return false;
 
       humidity <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > ALECTOV4_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > ALECTOV4_PULSEMAXMIN)
          humidity |= 0x1;
       else
       {
-         if (RawSignal.Pulses[x] < ALECTOV4_PULSEMIN)
+         if (RawSignal->Pulses[x] < ALECTOV4_PULSEMIN)
             return false;
-         if (RawSignal.Pulses[x] > ALECTOV4_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > ALECTOV4_PULSEMINMAX)
             return false;
          // humidity |= 0x0;
       }
@@ -118,9 +120,7 @@ boolean Plugin_032(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0) | humidity); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(032), tmpval, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -158,8 +158,7 @@ boolean Plugin_032(byte function, char *string)
       display_HUM(humidity, HUM_HEX);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_032
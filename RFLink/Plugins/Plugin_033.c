@@ -33,6 +33,7 @@
  \*********************************************************************************************/
 #define CONRAD_PLUGIN_ID 033
 #define PLUGIN_DESC_033 "Conrad"
+#define PLUGIN_PULSES_033 {CONRAD_PULSECOUNT, CONRAD_PULSECOUNT}
 #define CONRAD_PULSECOUNT 80
 
 #define CONRAD_PULSEMAX 5000 / RAWSIGNAL_SAMPLE_RATE
@@ -40,10 +41,11 @@
 
 #ifdef PLUGIN_033
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_033(byte function, char *string)
+boolean Plugin_033(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != CONRAD_PULSECOUNT)
+   if (RawSignal->Number != CONRAD_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L;
@@ -56,9 +58,9 @@ boolean Plugin_033(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x <= CONRAD_PULSECOUNT - 1; x += 2)
    {
-      if (RawSignal.Pulses[x] > CONRAD_PULSEMAX)
+      if (RawSignal->Pulses[x] > CONRAD_PULSEMAX)
       {
-         if (RawSignal.Pulses[x + 1] > CONRAD_PULSEMAX)
+         if (RawSignal->Pulses[x + 1] > CONRAD_PULSEMAX)
             if ((x + 1) < CONRAD_PULSECOUNT)
                return false; // invalid pulse length
 
@@ -73,10 +75,10 @@ boolean Plugin_033(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] > CONRAD_PULSEMIN)
+         if (RawSignal->Pulses[x] > CONRAD_PULSEMIN)
             return false; // invalid pulse length
 
-         if (RawSignal.Pulses[x + 1] < CONRAD_PULSEMIN)
+         if (RawSignal->Pulses[x + 1] < CONRAD_PULSEMIN)
             return false; // invalid pulse length
 
          if (bitcount > 7)
@@ -93,9 +95,7 @@ boolean Plugin_033(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(033), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -118,8 +118,7 @@ boolean Plugin_033(byte function, char *string)
    display_TEMP(temperature);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_033
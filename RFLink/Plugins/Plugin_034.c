@@ -27,6 +27,7 @@
  \*********************************************************************************************/
 #define CRESTA_PLUGIN_ID 034
 #define PLUGIN_DESC_034 "Cresta"
+#define PLUGIN_PULSES_034 {CRESTA_MIN_PULSECOUNT, CRESTA_MAX_PULSECOUNT}
 
 #define CRESTA_MIN_PULSECOUNT 124 // unknown until we have a collection of all packet types but this seems to be the minimum
 #define CRESTA_MAX_PULSECOUNT 284 // unknown until we have a collection of all packet types
@@ -34,14 +35,16 @@
 #define CRESTA_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_034
+#include "../2_Classify.h"
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 #include "../7_Utils.h"
 
 byte Plugin_034_WindDirSeg(byte data);
 
-boolean Plugin_034(byte function, char *string)
+boolean Plugin_034(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < CRESTA_MIN_PULSECOUNT) || (RawSignal.Number > CRESTA_MAX_PULSECOUNT))
+   if ((RawSignal->Number < CRESTA_MIN_PULSECOUNT) || (RawSignal->Number > CRESTA_MAX_PULSECOUNT))
       return false;
 
    byte bytecounter = 0;  // used for counting the number of received bytes
@@ -49,6 +52,7 @@ boolean Plugin_034(byte function, char *string)
    int pulseposition = 1; // first pulse is always empty
    byte halfbit = 0;      // high pulse = 1, 2 low pulses = 0, halfbit keeps track of low pulses
    byte parity = 0;       // to calculate byte parity
+   byte split = Classify_Split(RawSignal, CRESTA_PULSEMID);
 
    byte checksum = 0;
    byte data[18];
@@ -70,7 +74,7 @@ boolean Plugin_034(byte function, char *string)
    //==================================================================================
    do
    {
-      if (RawSignal.Pulses[pulseposition] > CRESTA_PULSEMID)
+      if (Classify_IsLong(RawSignal, pulseposition, split, CRESTA_PULSEMID))
       {                    // high value = 1 bit
          if (halfbit == 1) // cant receive a 1 bit after a single low value
             return false;  // pulse error, must not be a Cresta packet or reception error
@@ -124,7 +128,7 @@ boolean Plugin_034(byte function, char *string)
          }
       }
       pulseposition++; // point to next pulse
-      if (pulseposition > RawSignal.Number)
+      if (pulseposition > RawSignal->Number)
          break;                // reached the end? done processing
    } while (bytecounter < 16); // receive maximum number of bytes from pulses
    //==================================================================================
@@ -169,9 +173,7 @@ boolean Plugin_034(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = ((unsigned long)data[3] << 16) | ((data[1]) << 8) | channel;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(034), tmpval, 750))
       return true; // already seen the RF packet recently
    // ----------------------------------
    battery = !((data[2]) >> 6);
@@ -318,8 +320,7 @@ boolean Plugin_034(byte function, char *string)
       Serial.println();
       //==================================================================================
    }
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 
@@ -38,6 +38,7 @@
  \*********************************************************************************************/
 #define IMAGINTRONIX_PLUGIN_ID 035
 #define PLUGIN_DESC_035 "Imagintronix"
+#define PLUGIN_PULSES_035 {IMAGINTRONIX_PULSECOUNT, IMAGINTRONIX_PULSECOUNT}
 
 #define IMAGINTRONIX_PULSECOUNT 96
 
@@ -46,10 +47,11 @@
 
 #ifdef PLUGIN_035
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_035(byte function, char *string)
+boolean Plugin_035(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != IMAGINTRONIX_PULSECOUNT)
+   if (RawSignal->Number != IMAGINTRONIX_PULSECOUNT)
       return false;
    unsigned int temperature = 0;
    unsigned int rc = 0;
@@ -63,10 +65,10 @@ boolean Plugin_035(byte function, char *string)
    // get bits
    for (byte x = 1; x < IMAGINTRONIX_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x] > IMAGINTRONIX_PULSEMID)
+      if (RawSignal->Pulses[x] > IMAGINTRONIX_PULSEMID)
       { // long pulse = 0 bit
          if (x < 95)
-            if ((RawSignal.Pulses[x + 1] > IMAGINTRONIX_PULSEMID) || (RawSignal.Pulses[x + 1] < IMAGINTRONIX_PULSESHORT))
+            if ((RawSignal->Pulses[x + 1] > IMAGINTRONIX_PULSEMID) || (RawSignal->Pulses[x + 1] < IMAGINTRONIX_PULSESHORT))
                return false;
          data[bytecounter] <<= 1; // 0 bit
          // data[bytecounter] 0x0;// 0 bit
@@ -74,10 +76,10 @@ boolean Plugin_035(byte function, char *string)
       }
       else
       { // Short pulse = 1 bit
-         if (RawSignal.Pulses[x] > IMAGINTRONIX_PULSESHORT)
+         if (RawSignal->Pulses[x] > IMAGINTRONIX_PULSESHORT)
             return false; // Short pulse too long?
          if (x < 95)
-            if ((RawSignal.Pulses[x + 1] > IMAGINTRONIX_PULSEMID) || (RawSignal.Pulses[x + 1] < IMAGINTRONIX_PULSESHORT))
+            if ((RawSignal->Pulses[x + 1] > IMAGINTRONIX_PULSEMID) || (RawSignal->Pulses[x + 1] < IMAGINTRONIX_PULSESHORT))
                return false;
          data[bytecounter] <<= 1;  // 1 bit
          data[bytecounter] |= 0x1; // 1 bit
@@ -113,9 +115,7 @@ boolean Plugin_035(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(035), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    rc = (data[1]) & 0x3;
@@ -131,8 +131,7 @@ boolean Plugin_035(byte function, char *string)
    display_HUM(data[2], HUM_BCD);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_035
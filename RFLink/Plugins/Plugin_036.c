@@ -18,7 +18,8 @@
  * 
  * Data is manchester encoded and sent 3 times an row, in a packet of about 292-314 pulses.
  * Short pulses are appro 480us and long pulses 960us. 
- * Last pulses is approx 7000ms, but it is truncated by plugin 001, which keeps only 111 packets, a bit more than a third of max pulses.
+ * Last pulses is approx 7000ms, so the 3 copies fill the capture buffer. Only the first copy is decoded,
+ * it needs 111 pulses, a bit more than a third of max pulses.
  * 
  * Data is not verified against checksum
  * 
@@ -32,23 +33,41 @@
 
 #define F007_TH_PLUGIN_ID 036
 #define PLUGIN_DESC_036 "F007_TH"
-#define F007_TH_PULSECOUNT 111
+#define PLUGIN_PULSES_036 {RAW_BUFFER_SIZE - 1, RAW_BUFFER_SIZE - 1} // The 3 copies fill the capture buffer
+#define F007_TH_PULSECOUNT 111 // First copy of the burst, the one decoded
+#define F007_TH_PREAMBLE 24    // 19 short pulses then 5 long ones
 
 #define F007_TH_PULSE_MID  650 / RAWSIGNAL_SAMPLE_RATE
+#define F007_TH_PULSE600   600 / RAWSIGNAL_SAMPLE_RATE
+#define F007_TH_PULSE700   700 / RAWSIGNAL_SAMPLE_RATE
 
 #ifdef PLUGIN_036
+#include "../2_Classify.h"
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_036(byte function, char *string)
+boolean Plugin_036(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != F007_TH_PULSECOUNT)
+   if (RawSignal->Number != RAW_BUFFER_SIZE - 1)
       return false;
 
+   //==================================================================================
+   // Check the preamble before decoding anything of a full buffer
+   //==================================================================================
+   for (int i = 1; i <= F007_TH_PREAMBLE; i++)
+   {
+      if ((i < 20) && (RawSignal->Pulses[i] > F007_TH_PULSE600))
+         return false;
+      if ((i >= 20) && (RawSignal->Pulses[i] < F007_TH_PULSE700))
+         return false;
+   }
+
    byte toggle = 1;
    byte pulsecounter = 2;                                            // Pulse counter
    int bitcounter = 0;                                               // Bits counter 
    unsigned long headerstream = 0L ;                                 // Must be 111 1111 1101 0100 0101 (9 1's + '01' + 0x45) -> 19 Bits
    unsigned long datastream = 0L;                                    // Only the 32 first bits are processed, not the checksum
+   byte split = Classify_Split(RawSignal, F007_TH_PULSE_MID);        // Level of the long pulses, 0 to compare widths
 
    //==================================================================================
    // Get bits
@@ -57,9 +76,9 @@ boolean Plugin_036(byte function, char *string)
    while(bitcounter < 51)
    {
       bitcounter++;
-      if (RawSignal.Pulses[pulsecounter] < F007_TH_PULSE_MID)
+      if (!Classify_IsLong(RawSignal, pulsecounter, split, F007_TH_PULSE_MID))
       {                                                              // Short pulse in second half-bit -> same value
-         if (RawSignal.Pulses[pulsecounter+1] > F007_TH_PULSE_MID)   // First :Manchester check, the next pulse must alway be short
+         if (Classify_IsLong(RawSignal, pulsecounter + 1, split, F007_TH_PULSE_MID))   // First :Manchester check, the next pulse must alway be short
             return false;                                            // Invalid Manchester code
          pulsecounter += 2;                                          // Manchester OK -> don't toggle bit, move ahead to next half-bit
       }
@@ -90,9 +109,7 @@ boolean Plugin_036(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != datastream))
-      SignalCRC = datastream;
-   else
+   if (Repeat_Seen(PLUGIN_ID(036), datastream, 950))
       return true; // packet already seen
 
    //==================================================================================
@@ -120,8 +137,8 @@ boolean Plugin_036(byte function, char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
+   PluginResult.Quiet_ms = 700; // 3 copies per burst, same window as above
    return true;
 }
 #endif // Plugin_036
@@ -46,21 +46,27 @@
 // ==================================================================================
 #define MEBUS_PLUGIN_ID 040
 #define PLUGIN_DESC_040 "Mebus"
+#define PLUGIN_PULSES_040 {MEBUS_PULSECOUNT, MEBUS_PULSECOUNT}
 #define MEBUS_PULSECOUNT 58
 
-#define MEBUS_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMIN 1500 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMINMAX 2100 / RAWSIGNAL_SAMPLE_RATE
-#define MEBUS_PULSEMAXMIN 3400 / RAWSIGNAL_SAMPLE_RATE
+#define MEBUS_MARK_MIN 0
+#define MEBUS_MARK_MAX 550
+#define MEBUS_ZERO_MIN 1500
+#define MEBUS_ZERO_MAX 2100
+#define MEBUS_ONE_MIN (3400 + RAWSIGNAL_SAMPLE_RATE) // Over 3400
+#define MEBUS_ONE_MAX (255 * RAWSIGNAL_SAMPLE_RATE)  // No upper bound
 
 #ifdef PLUGIN_040
 #include "../4_Display.h"
+#include "../5_Repeat.h"
+#include "../5_LineCode.h"
 
-boolean Plugin_040(byte function, char *string)
+boolean Plugin_040(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != MEBUS_PULSECOUNT)
+   if (RawSignal->Number != MEBUS_PULSECOUNT)
       return false;
 
+   LineBits<28> bits;
    unsigned long bitstream = 0L;
    unsigned int temperature = 0;
    byte data[7];
@@ -70,24 +76,9 @@ boolean Plugin_040(byte function, char *string)
    //==================================================================================
    // Get all 28 bits
    //==================================================================================
-   for (byte x = 2; x <= MEBUS_PULSECOUNT - 2; x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > MEBUS_MIDHI)
-         return false; // make sure inbetween pulses are not too long
-
-      bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > MEBUS_PULSEMAXMIN)
-         bitstream |= 0x1;
-      else
-      {
-         if (RawSignal.Pulses[x] > MEBUS_PULSEMINMAX)
-            return false; // invalid pulse length
-         if (RawSignal.Pulses[x] < MEBUS_PULSEMIN)
-            return false; // invalid pulse length
-
-         // bitstream |= 0x0;
-      }
-   }
+   if (!PpmDecoder<MEBUS_MARK_MIN, MEBUS_MARK_MAX, MEBUS_ZERO_MIN, MEBUS_ZERO_MAX, MEBUS_ONE_MIN, MEBUS_ONE_MAX>::Decode(RawSignal, 2, bits))
+      return false; // invalid pulse length
+   bitstream = bits.Value(0, 28);
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -96,9 +87,7 @@ boolean Plugin_040(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 150 < millis() && SignalCRC != bitstream) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(040), bitstream, 400))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Prepare nibbles from bit stream
@@ -144,8 +133,7 @@ boolean Plugin_040(byte function, char *string)
    display_TEMP(temperature);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_040
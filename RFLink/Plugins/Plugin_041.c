@@ -81,6 +81,10 @@
  \*********************************************************************************************/
 #define LACROSSE41_PLUGIN_ID 041
 #define PLUGIN_DESC_041 "LaCrosseV3"
+#define PLUGIN_PULSES_041 {LACROSSE41_PULSECOUNT1, LACROSSE41_PULSECOUNT1}, \
+    {LACROSSE41_PULSECOUNT2, LACROSSE41_PULSECOUNT2}, \
+    {LACROSSE41_PULSECOUNT3, LACROSSE41_PULSECOUNT3}, \
+    {LACROSSE41_PULSECOUNT4, LACROSSE41_PULSECOUNT4}
 
 #define LACROSSE41_PULSECOUNT1 92  // Rain sensor
 #define LACROSSE41_PULSECOUNT2 162 // Meteo sensor
@@ -91,11 +95,12 @@
 
 #ifdef PLUGIN_041
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_041(byte function, char *string)
+boolean Plugin_041(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number != LACROSSE41_PULSECOUNT1) && (RawSignal.Number != LACROSSE41_PULSECOUNT2) &&
-       (RawSignal.Number != LACROSSE41_PULSECOUNT3) && (RawSignal.Number != LACROSSE41_PULSECOUNT4))
+   if ((RawSignal->Number != LACROSSE41_PULSECOUNT1) && (RawSignal->Number != LACROSSE41_PULSECOUNT2) &&
+       (RawSignal->Number != LACROSSE41_PULSECOUNT3) && (RawSignal->Number != LACROSSE41_PULSECOUNT4))
       return false;
 
    byte data[18];
@@ -108,17 +113,17 @@ boolean Plugin_041(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x < 20; x += 2)
    {
-      if ((RawSignal.Pulses[x] < LACROSSE41_PULSEMID) || (RawSignal.Pulses[x + 1] > LACROSSE41_PULSEMID))
+      if ((RawSignal->Pulses[x] < LACROSSE41_PULSEMID) || (RawSignal->Pulses[x + 1] > LACROSSE41_PULSEMID))
          return false; // bad preamble bit detected, abort
    }
-   if ((RawSignal.Pulses[21] > LACROSSE41_PULSEMID) || (RawSignal.Pulses[22] < LACROSSE41_PULSEMID))
+   if ((RawSignal->Pulses[21] > LACROSSE41_PULSEMID) || (RawSignal->Pulses[22] < LACROSSE41_PULSEMID))
       return false; // There should be a 1 bit after the preamble
    //==================================================================================
    // Get bits/nibbles
    //==================================================================================
-   for (byte x = 23; x < RawSignal.Number - 2; x += 2)
+   for (byte x = 23; x < RawSignal->Number - 2; x += 2)
    {
-      if (RawSignal.Pulses[x] < LACROSSE41_PULSEMID)
+      if (RawSignal->Pulses[x] < LACROSSE41_PULSEMID)
          data[bytecounter] = ((data[bytecounter] >> 1) | 0x08); // 1 bit, store in reversed bit order
       else
          data[bytecounter] = ((data[bytecounter] >> 1) & 0x07); // 0 bit, store in reversed bit order
@@ -127,10 +132,10 @@ boolean Plugin_041(byte function, char *string)
       if (bitcounter == 4)
       {
          x = x + 2;
-         if (x > RawSignal.Number - 2)
+         if (x > RawSignal->Number - 2)
             break; // dont check the last marker
 
-         if ((RawSignal.Pulses[x] > LACROSSE41_PULSEMID) || (RawSignal.Pulses[x + 1] < LACROSSE41_PULSEMID))
+         if ((RawSignal->Pulses[x] > LACROSSE41_PULSEMID) || (RawSignal->Pulses[x + 1] < LACROSSE41_PULSEMID))
             return false; // There should be a 1 bit after each nibble
 
          bitcounter = 0;
@@ -164,9 +169,7 @@ boolean Plugin_041(byte function, char *string)
    //==================================================================================
    unsigned long tempval = (((unsigned long)(data[4]) >> 1) << 16) | ((data[3]) << 8) | data[2];
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 150) < millis()) || (SignalCRC != tempval))
-      SignalCRC = tempval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(041), tempval, 400))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -226,8 +229,7 @@ boolean Plugin_041(byte function, char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true;
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true;
    return true;
 }
 #endif // PLUGIN_041
@@ -89,6 +89,7 @@
  \*********************************************************************************************/
 #define UPM_PLUGIN_ID 042
 #define PLUGIN_DESC_042 "UPM/Esic / UPM/Esic F2"
+#define PLUGIN_PULSES_042 {UPM_MIN_PULSECOUNT, UPM_MAX_PULSECOUNT}
 
 #define UPM_MIN_PULSECOUNT 46
 #define UPM_MAX_PULSECOUNT 56
@@ -99,10 +100,11 @@
 
 #ifdef PLUGIN_042
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_042(byte function, char *string)
+boolean Plugin_042(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number < UPM_MIN_PULSECOUNT || RawSignal.Number > UPM_MAX_PULSECOUNT)
+   if (RawSignal->Number < UPM_MIN_PULSECOUNT || RawSignal->Number > UPM_MAX_PULSECOUNT)
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 10 bits
@@ -124,9 +126,9 @@ boolean Plugin_042(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number; x++)
+   for (byte x = 1; x < RawSignal->Number; x++)
    {
-      if ((RawSignal.Pulses[x] > UPM_PULSEHILO) && (RawSignal.Pulses[x] < UPM_PULSEHIHI))
+      if ((RawSignal->Pulses[x] > UPM_PULSEHILO) && (RawSignal->Pulses[x] < UPM_PULSEHIHI))
       {
          if (halfbit == 1) // UPM cant receive a 1 bit after a single low value
             return false;  // pulse error, must not be a UPM packet or reception error
@@ -143,7 +145,7 @@ boolean Plugin_042(byte function, char *string)
       }
       else
       {
-         if ((RawSignal.Pulses[x] > UPM_PULSELOHI))
+         if ((RawSignal->Pulses[x] > UPM_PULSELOHI))
             return false; // Not a valid UPM pulse length
 
          if (halfbit == 0) // 2 times a low value = 0 bit
@@ -207,9 +209,7 @@ boolean Plugin_042(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream1))
-      SignalCRC = bitstream1; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(042), bitstream1, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -306,8 +306,7 @@ boolean Plugin_042(byte function, char *string)
    display_BAT(battery);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_042
@@ -89,6 +89,7 @@
   \*********************************************************************************************/
 #define LACROSSE43_PLUGIN_ID 043
 #define PLUGIN_DESC_043 "LaCrosse"
+#define PLUGIN_PULSES_043 {LACROSSE43_PULSECOUNT - 4, LACROSSE43_PULSECOUNT + 4}
 
 #define LACROSSE43_PULSECOUNT 88 // also handles 84 to 92 pulses!
 
@@ -100,10 +101,11 @@
 
 #ifdef PLUGIN_043
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_043(byte function, char *string)
+boolean Plugin_043(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < LACROSSE43_PULSECOUNT - 4) || (RawSignal.Number > LACROSSE43_PULSECOUNT + 4))
+   if ((RawSignal->Number < LACROSSE43_PULSECOUNT - 4) || (RawSignal->Number > LACROSSE43_PULSECOUNT + 4))
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 5x4=20 bits
@@ -117,21 +119,23 @@ boolean Plugin_043(byte function, char *string)
    //==================================================================================
    // Get all 44 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number; x += 2)
+   for (byte x = 1; x < RawSignal->Number; x += 2)
    {
-      if ((RawSignal.Pulses[x + 1] < LACROSSE43_MIDLO) || (RawSignal.Pulses[x + 1] > LACROSSE43_MIDHI))
+      byte pulse = RawSignal->Pulses[x];
+
+      if ((RawSignal->Pulses[x + 1] < LACROSSE43_MIDLO) || (RawSignal->Pulses[x + 1] > LACROSSE43_MIDHI))
       {
          if (x == 1) // Make sure the first bit is correct..
-            RawSignal.Pulses[1] = LACROSSE43_PULSEMAX - 1;
+            pulse = LACROSSE43_PULSEMAX - 1;
          else
          {
-            if ((x + 1) < RawSignal.Number) // in between pulse check
+            if ((x + 1) < RawSignal->Number) // in between pulse check
                return false;
          }
       }
-      if (RawSignal.Pulses[x] > LACROSSE43_PULSEMAXMIN)
+      if (pulse > LACROSSE43_PULSEMAXMIN)
       {
-         if ((RawSignal.Pulses[x] > LACROSSE43_PULSEMAX) && (x > 1))
+         if ((pulse > LACROSSE43_PULSEMAX) && (x > 1))
             return false;
 
          if (bitcounter < 20)
@@ -144,7 +148,7 @@ boolean Plugin_043(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] > LACROSSE43_PULSEMINMAX)
+         if (pulse > LACROSSE43_PULSEMINMAX)
             return false;
 
          if (bitcounter < 20)
@@ -160,9 +164,9 @@ boolean Plugin_043(byte function, char *string)
          }
       }
    }
-   if (RawSignal.Number == (LACROSSE43_PULSECOUNT - 4))
+   if (RawSignal->Number == (LACROSSE43_PULSECOUNT - 4))
       bitstream2 = (bitstream2 << 2); // add missing zero bit
-   if (RawSignal.Number == (LACROSSE43_PULSECOUNT - 2))
+   if (RawSignal->Number == (LACROSSE43_PULSECOUNT - 2))
       bitstream2 = (bitstream2 << 1); // add missing zero bit
    //==================================================================================
    // Perform a quick sanity check
@@ -203,9 +207,7 @@ boolean Plugin_043(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[10]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(043), tmpval, 250))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -228,8 +230,7 @@ boolean Plugin_043(byte function, char *string)
       display_TEMP(temperature);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = false;
-      RawSignal.Number = 0;
+      PluginResult.Quiet_ms = 0; // No quiet window
       return true;
    }
    else if (data[2] == 0xE)
@@ -248,8 +249,7 @@ boolean Plugin_043(byte function, char *string)
       display_HUM(humidity, HUM_HEX);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true;
-      RawSignal.Number = 0;
+      PluginResult.Quiet = true;
       return true;
    }
    else
@@ -36,6 +36,7 @@
  \*********************************************************************************************/
 #define AURIOLV3_PLUGIN_ID 044
 #define PLUGIN_DESC_044 "Auriol V3"
+#define PLUGIN_PULSES_044 {AURIOLV3_PULSECOUNT, AURIOLV3_PULSECOUNT}
 #define AURIOLV3_PULSECOUNT 82
 
 #define AURIOLV3_MIDHI 650 / RAWSIGNAL_SAMPLE_RATE
@@ -46,10 +47,11 @@
 
 #ifdef PLUGIN_044
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_044(byte function, char *string)
+boolean Plugin_044(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != AURIOLV3_PULSECOUNT)
+   if (RawSignal->Number != AURIOLV3_PULSECOUNT)
       return false;
 
    unsigned long bitstream1 = 0L; // holds first 4x4=16 bits
@@ -64,9 +66,9 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x < AURIOLV3_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > AURIOLV3_MIDHI)
+      if (RawSignal->Pulses[x + 1] * RawSignal->Multiply > AURIOLV3_MIDHI)
          return false;
-      if (RawSignal.Pulses[x] > AURIOLV3_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > AURIOLV3_PULSEMAXMIN)
       {
          if (bitcounter < 16)
          {
@@ -82,9 +84,9 @@ boolean Plugin_044(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] > AURIOLV3_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > AURIOLV3_PULSEMINMAX)
             return false;
-         if (RawSignal.Pulses[x] < AURIOLV3_PULSEMIN)
+         if (RawSignal->Pulses[x] < AURIOLV3_PULSEMIN)
             return false;
          if (bitcounter < 16)
          {
@@ -98,17 +100,12 @@ boolean Plugin_044(byte function, char *string)
    //==================================================================================
    // Perform sanity checks and prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()))
-   {
-      if (bitstream1 == 0)
-         return false; // not seen the RF packet recently
-      if (bitstream2 == 0)
-         return false;
-   }
-   else
-   {
+   if (bitstream1 == 0)
+      return false;
+   if (bitstream2 == 0)
+      return false;
+   if (Repeat_Seen(PLUGIN_ID(044), (bitstream1 << 16) ^ bitstream2, 250))
       return true; // already seen the RF packet recently
-   }
    //==================================================================================
    // now process sensor type
    //==================================================================================
@@ -142,8 +139,7 @@ boolean Plugin_044(byte function, char *string)
    display_HUM(humidity, HUM_HEX);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_044
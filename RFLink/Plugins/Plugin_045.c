@@ -34,6 +34,7 @@
  \*********************************************************************************************/
 #define AURIOL_PLUGIN_ID 045
 #define PLUGIN_DESC_045 "Auriol"
+#define PLUGIN_PULSES_045 {AURIOL_PULSECOUNT, AURIOL_PULSECOUNT}
 #define AURIOL_PULSECOUNT 66
 
 #define AURIOL_MIDHI 550 / RAWSIGNAL_SAMPLE_RATE
@@ -44,10 +45,11 @@
 
 #ifdef PLUGIN_045
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_045(byte function, char *string)
+boolean Plugin_045(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != AURIOL_PULSECOUNT)
+   if (RawSignal->Number != AURIOL_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L; // holds 8x4=32 bits
@@ -60,18 +62,18 @@ boolean Plugin_045(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x < AURIOL_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x + 1] > AURIOL_MIDHI)
+      if (RawSignal->Pulses[x + 1] > AURIOL_MIDHI)
          return false; // in between pulses should not exceed a length of 550
 
       bitstream <<= 1; // Always shift
 
-      if (RawSignal.Pulses[x] > AURIOL_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > AURIOL_PULSEMAXMIN)
          bitstream |= 0x1; // long bit = 1
       else
       {
-         if (RawSignal.Pulses[x] < AURIOL_PULSEMIN)
+         if (RawSignal->Pulses[x] < AURIOL_PULSEMIN)
             return false; // pulse length too short to be valid?
-         if (RawSignal.Pulses[x] > AURIOL_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > AURIOL_PULSEMINMAX)
             return false; // pulse length between 2000 - 3000 is invalid
 
          // bitstream |= 0x0; // short bit = 0
@@ -85,9 +87,7 @@ boolean Plugin_045(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(045), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -131,8 +131,7 @@ boolean Plugin_045(byte function, char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_045
@@ -46,27 +46,30 @@
  \*********************************************************************************************/
 #define AURIOLV2_PLUGIN_ID 046
 #define PLUGIN_DESC_046 "Auriol V2 / Xiron"
+#define PLUGIN_PULSES_046 {AURIOLV2_PULSECOUNT, AURIOLV2_PULSECOUNT}
 
 #define AURIOLV2_PULSECOUNT 74
 
-#define AURIOLV2_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
-
-#define AURIOLV2_PULSEMIN 500 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMINMAX 1100 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMAXMIN 1400 / RAWSIGNAL_SAMPLE_RATE
-#define AURIOLV2_PULSEMAX 2100 / RAWSIGNAL_SAMPLE_RATE
+#define AURIOLV2_MARK_MIN 0
+#define AURIOLV2_MARK_MAX 700
+#define AURIOLV2_ZERO_MIN 500
+#define AURIOLV2_ZERO_MAX 1100
+#define AURIOLV2_ONE_MIN (1400 + RAWSIGNAL_SAMPLE_RATE) // Over 1400
+#define AURIOLV2_ONE_MAX 2100
 
 #ifdef PLUGIN_046
 #include "../4_Display.h"
+#include "../5_Repeat.h"
+#include "../5_LineCode.h"
 
-boolean Plugin_046(byte function, char *string)
+boolean Plugin_046(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != AURIOLV2_PULSECOUNT)
+   if (RawSignal->Number != AURIOLV2_PULSECOUNT)
       return false;
 
+   LineBits<36> bits;
    unsigned long bitstream1 = 0L; // holds first 6x4=24 bits
    unsigned long bitstream2 = 0L; // holds last  3x4=12 bits
-   byte bitcounter = 0;           // counts number of received bits (converted from pulses)
    byte rc = 0;
    byte bat = 0;
    byte bat0 = 0;
@@ -77,41 +80,10 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    // Get all 36 bits
    //==================================================================================
-   for (byte x = 2; x < (AURIOLV2_PULSECOUNT); x += 2)
-   {
-      if (RawSignal.Pulses[x + 1] > AURIOLV2_MIDHI)
-         return false;
-      if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAXMIN)
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMAX)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitstream1 |= 0x1;
-            bitcounter++; // only need to count the first 24 bits
-         }
-         else
-         {
-            bitstream2 <<= 1;
-            bitstream2 |= 0x1;
-         }
-      }
-      else
-      {
-         if (RawSignal.Pulses[x] > AURIOLV2_PULSEMINMAX)
-            return false;
-         if (RawSignal.Pulses[x] < AURIOLV2_PULSEMIN)
-            return false;
-         if (bitcounter < 24)
-         {
-            bitstream1 <<= 1;
-            bitcounter++; // only need to count the first 10 bits
-         }
-         else
-            bitstream2 <<= 1;
-      }
-   }
+   if (!PpmDecoder<AURIOLV2_MARK_MIN, AURIOLV2_MARK_MAX, AURIOLV2_ZERO_MIN, AURIOLV2_ZERO_MAX, AURIOLV2_ONE_MIN, AURIOLV2_ONE_MAX>::Decode(RawSignal, 2, bits))
+      return false;
+   bitstream1 = bits.Value(0, 24);
+   bitstream2 = bits.Value(24, 12);
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -124,9 +96,7 @@ boolean Plugin_046(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 8) | (bitstream2 & 0xFF); // All but "1111" padded section
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(046), tmpval, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -137,7 +107,7 @@ boolean Plugin_046(byte function, char *string)
       type = 0; // Auriol has no humidity part
    else
       type = 1; // Xiron
-   // if (RawSignal.Pulses[0] != AURIOLV2_PLUGIN_ID)
+   // if (RawSignal->Pulses[0] != AURIOLV2_PLUGIN_ID)
    //   return false; // only accept plugin_001 translated Xiron packets
    //==================================================================================
    if (type == 0)
@@ -192,8 +162,7 @@ boolean Plugin_046(byte function, char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_046
@@ -34,6 +34,7 @@
  \*********************************************************************************************/
 #define AURIOLV4_PLUGIN_ID 047
 #define PLUGIN_DESC_047 "Auriol V4"
+#define PLUGIN_PULSES_047 {AURIOLV4_PULSECOUNT - 4, AURIOLV4_PULSECOUNT + 2}
 #define AURIOLV4_PULSECOUNT 88
 
 #define AURIOLV4_MIDLO 128 / RAWSIGNAL_SAMPLE_RATE
@@ -46,11 +47,12 @@
 
 #ifdef PLUGIN_047
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 #include "../7_Utils.h"
 
-boolean Plugin_047(byte function, char *string)
+boolean Plugin_047(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < AURIOLV4_PULSECOUNT - 4) || (RawSignal.Number > AURIOLV4_PULSECOUNT + 2))
+   if ((RawSignal->Number < AURIOLV4_PULSECOUNT - 4) || (RawSignal->Number > AURIOLV4_PULSECOUNT + 2))
       return false;
 
    unsigned long bitstream = 0L; // holds first 8x4=32 bits
@@ -66,9 +68,9 @@ boolean Plugin_047(byte function, char *string)
    //==================================================================================
    // Get all 40 bits
    //==================================================================================
-   for (byte x = 1; x < RawSignal.Number; x += 2)
+   for (byte x = 1; x < RawSignal->Number; x += 2)
    {
-      if ((RawSignal.Pulses[x + 1] < AURIOLV4_MIDLO) || (RawSignal.Pulses[x + 1] > AURIOLV4_MIDHI))
+      if ((RawSignal->Pulses[x + 1] < AURIOLV4_MIDLO) || (RawSignal->Pulses[x + 1] > AURIOLV4_MIDHI))
       {
          if (bitcounter == 0) // Possible (4) Sync bits
             continue;
@@ -77,9 +79,9 @@ boolean Plugin_047(byte function, char *string)
             return false;
       }
 
-      if (RawSignal.Pulses[x] > AURIOLV4_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > AURIOLV4_PULSEMAXMIN)
       {
-         if (RawSignal.Pulses[x] > AURIOLV4_PULSEMAX)
+         if (RawSignal->Pulses[x] > AURIOLV4_PULSEMAX)
             return false;
 
          if (bitcounter < 32)
@@ -95,10 +97,10 @@ boolean Plugin_047(byte function, char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] < AURIOLV4_PULSEMIN)
+         if (RawSignal->Pulses[x] < AURIOLV4_PULSEMIN)
             return false;
 
-         if (RawSignal.Pulses[x] > AURIOLV4_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > AURIOLV4_PULSEMINMAX)
             return false;
 
          if (bitcounter < 32)
@@ -120,9 +122,7 @@ boolean Plugin_047(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(047), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -178,8 +178,7 @@ boolean Plugin_047(byte function, char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_047
@@ -37,6 +37,7 @@
  \*********************************************************************************************/
 #define DIGOOR8S_PLUGIN_ID 050
 #define PLUGIN_DESC_050 "DIGOO R8S"
+#define PLUGIN_PULSES_050 {DIGOOR8S_PULSECOUNT, DIGOOR8S_PULSECOUNT}
 #define DIGOOR8S_PULSECOUNT 76
 
 #define DIGOOR8S_MIDHI 600 / RAWSIGNAL_SAMPLE_RATE
@@ -46,11 +47,12 @@
 
 #ifdef PLUGIN_050
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_050(byte function, char *string)
+boolean Plugin_050(byte function, const RawSignalStruct *RawSignal)
 {
-   //Serial.print(RawSignal.Number);
-   if (RawSignal.Number != DIGOOR8S_PULSECOUNT)
+   //Serial.print(RawSignal->Number);
+   if (RawSignal->Number != DIGOOR8S_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L;
@@ -68,17 +70,17 @@ boolean Plugin_050(byte function, char *string)
 
    for (byte x = 2 + start; x <= 56 + start; x += 2)
    { // Get first 28 bits
-      if (RawSignal.Pulses[x + 1] > DIGOOR8S_MIDHI)
+      if (RawSignal->Pulses[x + 1] > DIGOOR8S_MIDHI)
          return false;
 
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > DIGOOR8S_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > DIGOOR8S_PULSEMAXMIN)
          bitstream |= 0x1;
       else
       {
-         if (RawSignal.Pulses[x] < DIGOOR8S_PULSEMIN)
+         if (RawSignal->Pulses[x] < DIGOOR8S_PULSEMIN)
             return false;
-         if (RawSignal.Pulses[x] > DIGOOR8S_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > DIGOOR8S_PULSEMINMAX)
             return false;
          // bitstream |= 0x0;
       }
@@ -86,17 +88,17 @@ boolean Plugin_050(byte function, char *string)
 
    for (byte x = 58 + start; x <= 72 + start; x = x + 2)
    { // Get remaining 8 bits
-      if (RawSignal.Pulses[x + 1] > DIGOOR8S_MIDHI)
+      if (RawSignal->Pulses[x + 1] > DIGOOR8S_MIDHI)
          return false;
 
       humidity <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > DIGOOR8S_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > DIGOOR8S_PULSEMAXMIN)
          humidity |= 0x1;
       else
       {
-         if (RawSignal.Pulses[x] < DIGOOR8S_PULSEMIN)
+         if (RawSignal->Pulses[x] < DIGOOR8S_PULSEMIN)
             return false;
-         if (RawSignal.Pulses[x] > DIGOOR8S_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > DIGOOR8S_PULSEMINMAX)
             return false;
          // humidity |= 0x0;
       }
@@ -142,9 +144,7 @@ boolean Plugin_050(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF00) | humidity); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(050), tmpval, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -160,8 +160,7 @@ boolean Plugin_050(byte function, char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_050
@@ -34,6 +34,7 @@
  \*********************************************************************************************/
 #define DIGOOEX3_PLUGIN_ID 051
 #define PLUGIN_DESC_051 "DIGOO EX3"
+#define PLUGIN_PULSES_051 {DIGOOEX3_PULSECOUNT, DIGOOEX3_PULSECOUNT}
 #define DIGOOEX3_PULSECOUNT 82  // 40 bit + sync/timeout 
 
 #define DIGOOEX3_MIDHI 700 / RAWSIGNAL_SAMPLE_RATE
@@ -43,15 +44,16 @@
 
 #ifdef PLUGIN_051
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
 
 #if ((SIGNAL_MIN_PREAMBLE_US + SIGNAL_END_TIMEOUT_US) > 7000)  // in fact delay between preamble and frame is 7.9ms. If MIN_PREAMBLE is too long, the beginning of the frame is missed.
 #error SIGNAL_MIN_PREAMBLE_US is to long to detect correctly the start of a frame
 #endif
 
-boolean Plugin_051(byte function, char *string)
+boolean Plugin_051(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != DIGOOEX3_PULSECOUNT)
+   if (RawSignal->Number != DIGOOEX3_PULSECOUNT)
       return false;
 
    byte buf[5];
@@ -69,18 +71,18 @@ boolean Plugin_051(byte function, char *string)
    buf[nbuf] = 0;
    for (byte x = start+1 ; x <= (DIGOOEX3_PULSECOUNT-2 + start) ; x++)      //Signal starts at Pulses[1], 
    { 
-      if (RawSignal.Pulses[x] > DIGOOEX3_MIDHI)
+      if (RawSignal->Pulses[x] > DIGOOEX3_MIDHI)
          return false;
 
       c <<= 1; // Always shift
       x++;
-      if (RawSignal.Pulses[x] > DIGOOEX3_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > DIGOOEX3_PULSEMAXMIN)
          c |= 0x1;
       else
       {
-         if (RawSignal.Pulses[x] < DIGOOEX3_PULSEMIN)
+         if (RawSignal->Pulses[x] < DIGOOEX3_PULSEMIN)
             return false;
-         if (RawSignal.Pulses[x] > DIGOOEX3_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > DIGOOEX3_PULSEMINMAX)
             return false;
          // c |= 0x0;
       }
@@ -112,9 +114,7 @@ boolean Plugin_051(byte function, char *string)
    //==================================================================================
    unsigned long tmpval = ((temperature << 8) | humidity);
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(051), tmpval, 750))
       return true; // already seen the RF packet recently
 
    //==================================================================================
@@ -128,8 +128,7 @@ boolean Plugin_051(byte function, char *string)
       display_HUM(humidity, HUM_BCD);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_051
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 #define _PLUGIN_ID 052
 #define PLUGIN_DESC_052 "ATECH WS301E"
+#define PLUGIN_PULSES_052 {ATECH301_PULSECOUNT_MIN, ATECH301_PULSECOUNT_MAX}
 #define ATECH301_PULSECOUNT_MIN 60 // 60 min to 172 max
 #define ATECH301_PULSECOUNT_MAX 172 
 
@@ -45,6 +46,7 @@
 
 #ifdef PLUGIN_052
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
 #if 0
 void display_RawSignal(int mode)
@@ -77,9 +79,9 @@ void display_RawSignal(int mode)
 //#define ERROR_END_P052(x)   {err = x; goto ERROR;}
 #define ERROR_END_P052(x)   {goto ERROR;}
 
-boolean Plugin_052(byte function, char *string)
+boolean Plugin_052(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < ATECH301_PULSECOUNT_MIN) || (RawSignal.Number > (ATECH301_PULSECOUNT_MAX)))
+   if ((RawSignal->Number < ATECH301_PULSECOUNT_MIN) || (RawSignal->Number > (ATECH301_PULSECOUNT_MAX)))
       return false;
 
    byte buf[11];     // 11 = decoding worst wrong case ( (ATECH301_PULSECOUNT_MAX-4) /2 )
@@ -95,20 +97,20 @@ boolean Plugin_052(byte function, char *string)
    // Decode all bits in buff
    //==================================================================================
    buf[i] = 0;
-   for (byte x = 1 ; x <= (RawSignal.Number-4) ; x++)      //Signal starts at Pulses[1], -4 don't decode "stop" bit
+   for (byte x = 1 ; x <= (RawSignal->Number-4) ; x++)      //Signal starts at Pulses[1], -4 don't decode "stop" bit
    { 
-      if ((RawSignal.Pulses[x] < ATECH301_PULSE_MIN) || (RawSignal.Pulses[x] > ATECH301_PULSE_MAX))
+      if ((RawSignal->Pulses[x] < ATECH301_PULSE_MIN) || (RawSignal->Pulses[x] > ATECH301_PULSE_MAX))
          ERROR_END_P052(__LINE__);
 
       c <<= 1; // Always shift
       x++;
-      if ((RawSignal.Pulses[x] > ATECH301_GAP0_MIN) && (RawSignal.Pulses[x] < ATECH301_GAP0_MAX)) 
+      if ((RawSignal->Pulses[x] > ATECH301_GAP0_MIN) && (RawSignal->Pulses[x] < ATECH301_GAP0_MAX)) 
       {
          // case long gap -> bit 0
       }
       else
       {  //check case bit 1: short gap + pulse + short gap + pulse ~ 3.7 ms
-         unsigned int total = RawSignal.Pulses[x] + RawSignal.Pulses[x+1] + RawSignal.Pulses[x+2] + RawSignal.Pulses[x+3];
+         unsigned int total = RawSignal->Pulses[x] + RawSignal->Pulses[x+1] + RawSignal->Pulses[x+2] + RawSignal->Pulses[x+3];
          if ((total > ATECH301_PAT1_MAX) || (total < ATECH301_PAT1_MIN)) 
            ERROR_END_P052(__LINE__);
          c |= 0x1;
@@ -146,9 +148,7 @@ boolean Plugin_052(byte function, char *string)
    //==================================================================================
    tmpval = (buf[0]<<16) + temperature;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(052), tmpval, 750))
       return true; // already seen the RF packet recently
 
    //==================================================================================
@@ -162,8 +162,7 @@ boolean Plugin_052(byte function, char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 
 ERROR:
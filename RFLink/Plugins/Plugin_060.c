@@ -28,6 +28,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV0_PLUGIN_ID 060
 #define PLUGIN_DESC_060 "X10"
+#define PLUGIN_PULSES_060 {ALARMPIRV0_PULSECOUNT, ALARMPIRV0_PULSECOUNT}
 
 #define ALARMPIRV0_PULSECOUNT 26
 
@@ -38,36 +39,37 @@
 
 #ifdef PLUGIN_060
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_060(byte function, char *string)
+boolean Plugin_060(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != ALARMPIRV0_PULSECOUNT)
+   if (RawSignal->Number != ALARMPIRV0_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L;
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[1] > ALARMPIRV0_PULSESHORT)
+   if (RawSignal->Pulses[1] > ALARMPIRV0_PULSESHORT)
       return false; // First pulse is start bit and should be short!
    //==================================================================================
    // Get all 12 bits
    //==================================================================================
    for (byte x = 2; x < ALARMPIRV0_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x] > ALARMPIRV0_PULSEMID)
+      if (RawSignal->Pulses[x] > ALARMPIRV0_PULSEMID)
       { // long pulse 800-875 (700-1000 accepted)
-         if (RawSignal.Pulses[x] > ALARMPIRV0_PULSEMAX)
+         if (RawSignal->Pulses[x] > ALARMPIRV0_PULSEMAX)
             return false; // pulse too long
-         if (RawSignal.Pulses[x + 1] > ALARMPIRV0_PULSEMID)
+         if (RawSignal->Pulses[x + 1] > ALARMPIRV0_PULSEMID)
             return false; // invalid manchester code
          bitstream = bitstream << 1;
       }
       else
       { // short pulse 350-425 (250-550 accepted)
-         if (RawSignal.Pulses[x] < ALARMPIRV0_PULSEMIN)
+         if (RawSignal->Pulses[x] < ALARMPIRV0_PULSEMIN)
             return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] < ALARMPIRV0_PULSEMID)
+         if (RawSignal->Pulses[x + 1] < ALARMPIRV0_PULSEMID)
             return false; // invalid manchester code
          bitstream = (bitstream << 1) | 0x1;
       }
@@ -75,17 +77,10 @@ boolean Plugin_060(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (Repeat_Seen(PLUGIN_ID(060), bitstream, 2250))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Output
    // ----------------------------------
@@ -96,8 +91,7 @@ boolean Plugin_060(byte function, char *string)
    display_CMD(CMD_Single, CMD_On); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_060
@@ -38,6 +38,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV1_PLUGIN_ID 061
 #define PLUGIN_DESC_061 "EV1527"
+#define PLUGIN_PULSES_061 {ALARMPIRV1_PULSECOUNT, ALARMPIRV1_PULSECOUNT}
 
 #define ALARMPIRV1_PULSECOUNT 50
 
@@ -47,12 +48,13 @@
 
 #ifdef PLUGIN_061
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_061(byte function, char *string)
+boolean Plugin_061(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != ALARMPIRV1_PULSECOUNT)
+   if (RawSignal->Number != ALARMPIRV1_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (RawSignal->Pulses[0] == 63)
       return false; // No need to test, packet for plugin 63
    unsigned long bitstream = 0L;
    unsigned long bitstream2 = 0L;
@@ -61,19 +63,19 @@ boolean Plugin_061(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x <= 48; x += 2)
    {
-      if (RawSignal.Pulses[x] > ALARMPIRV1_PULSEMID)
+      if (RawSignal->Pulses[x] > ALARMPIRV1_PULSEMID)
       {
-         if (RawSignal.Pulses[x] > ALARMPIRV1_PULSEMAX)
+         if (RawSignal->Pulses[x] > ALARMPIRV1_PULSEMAX)
             return false; // pulse too long
-         if (RawSignal.Pulses[x - 1] > ALARMPIRV1_PULSEMID)
+         if (RawSignal->Pulses[x - 1] > ALARMPIRV1_PULSEMID)
             return false; // invalid pulse sequence 10/01
          bitstream = bitstream << 1;
       }
       else
       {
-         if (RawSignal.Pulses[x] < ALARMPIRV1_PULSEMIN)
+         if (RawSignal->Pulses[x] < ALARMPIRV1_PULSEMIN)
             return false; // pulse too short
-         if (RawSignal.Pulses[x - 1] < ALARMPIRV1_PULSEMID)
+         if (RawSignal->Pulses[x - 1] < ALARMPIRV1_PULSEMID)
             return false; // invalid pulse sequence 10/01
          bitstream = (bitstream << 1) | 0x1;
       }
@@ -82,19 +84,10 @@ boolean Plugin_061(byte function, char *string)
    // Prevent repeating signals from showing up
    //==================================================================================
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (Repeat_Seen(PLUGIN_ID(061), bitstream, 450))
+      return true; // already seen the RF packet recently
    //==================================================================================
    bitstream2 = (bitstream) >> 16;
    if ((bitstream2) == 0xff)
@@ -112,8 +105,7 @@ boolean Plugin_061(byte function, char *string)
    display_CMD(CMD_Single, CMD_On); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_061
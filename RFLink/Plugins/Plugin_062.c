@@ -25,6 +25,7 @@
  \*********************************************************************************************/
 #define ALARMPIRV2_PLUGIN_ID 062
 #define PLUGIN_DESC_062 "Chuango"
+#define PLUGIN_PULSES_062 {ALARMPIRV2_PULSECOUNT, ALARMPIRV2_PULSECOUNT}
 
 #define ALARMPIRV2_PULSECOUNT 50
 
@@ -34,12 +35,13 @@
 
 #ifdef PLUGIN_062
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_062(byte function, char *string)
+boolean Plugin_062(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != ALARMPIRV2_PULSECOUNT)
+   if (RawSignal->Number != ALARMPIRV2_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (RawSignal->Pulses[0] == 63)
       return false; // No need to test, packet for plugin 63
       
    unsigned long bitstream = 0L;
@@ -48,19 +50,19 @@ boolean Plugin_062(byte function, char *string)
    //==================================================================================
    for (byte x = 2; x <= 48; x += 2)
    {
-      if (RawSignal.Pulses[x] > ALARMPIRV2_PULSEMID)
+      if (RawSignal->Pulses[x] > ALARMPIRV2_PULSEMID)
       {
-         if (RawSignal.Pulses[x] > ALARMPIRV2_PULSEMAX)
+         if (RawSignal->Pulses[x] > ALARMPIRV2_PULSEMAX)
             return false; // pulse too long
-         if (RawSignal.Pulses[x - 1] > ALARMPIRV2_PULSEMID)
+         if (RawSignal->Pulses[x - 1] > ALARMPIRV2_PULSEMID)
             return false; // invalid pulse sequence 10/01
          bitstream = (bitstream << 1) | 0x1;
       }
       else
       {
-         if (RawSignal.Pulses[x] < ALARMPIRV2_PULSEMIN)
+         if (RawSignal->Pulses[x] < ALARMPIRV2_PULSEMIN)
             return false; // pulse too short
-         if (RawSignal.Pulses[x - 1] < ALARMPIRV2_PULSEMID)
+         if (RawSignal->Pulses[x - 1] < ALARMPIRV2_PULSEMID)
             return false; // invalid pulse sequence 10/01
          bitstream = bitstream << 1;
       }
@@ -68,19 +70,10 @@ boolean Plugin_062(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (Repeat_Seen(PLUGIN_ID(062), bitstream, 450))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Validity checks
    //==================================================================================
@@ -94,8 +87,7 @@ boolean Plugin_062(byte function, char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_062
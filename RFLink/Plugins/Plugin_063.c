@@ -21,20 +21,21 @@
  \*********************************************************************************************/
 #define OREGON_PLA_PLUGIN_ID 063
 #define PLUGIN_DESC_063 "X10"
+#define PLUGIN_PULSES_063 {OREGON_PLA_PULSECOUNT - 2, OREGON_PLA_PULSECOUNT}
 
 #define OREGON_PLA_PULSECOUNT 52
 
 #ifdef PLUGIN_063
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_063(byte function, char *string)
+boolean Plugin_063(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number < OREGON_PLA_PULSECOUNT - 2) || (RawSignal.Number > OREGON_PLA_PULSECOUNT))
+   if ((RawSignal->Number < OREGON_PLA_PULSECOUNT - 2) || (RawSignal->Number > OREGON_PLA_PULSECOUNT))
       return false;
 
-   if (RawSignal.Pulses[0] != 63)
+   if (RawSignal->Pulses[0] != 63)
       return false; // Only accept RF packets converted by plugin 1
-   RawSignal.Pulses[0] = 0;
 
    unsigned long bitstream = 0L;
    //==================================================================================
@@ -42,9 +43,9 @@ boolean Plugin_063(byte function, char *string)
    //==================================================================================
    for (byte x = 1; x < 28; x += 2)
    {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
+      if (RawSignal->Pulses[x] * RawSignal->Multiply > 600)
          return false;
-      if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 600)
+      if (RawSignal->Pulses[x + 1] * RawSignal->Multiply > 600)
          return false;
    }
    //==================================================================================
@@ -53,38 +54,31 @@ boolean Plugin_063(byte function, char *string)
    //==================================================================================
    // Get all 24 bits
    //==================================================================================
-   for (byte x = 29; x <= RawSignal.Number; x++)
+   for (byte x = 29; x <= RawSignal->Number; x++)
    {
-      if (RawSignal.Pulses[x] * RawSignal.Multiply > 600)
+      if (RawSignal->Pulses[x] * RawSignal->Multiply > 600)
       { // toggle bit value
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 1600)
+         if (RawSignal->Pulses[x] * RawSignal->Multiply > 1600)
             break; // done..
          rfbit = (~rfbit) & 1;
          bitstream = (bitstream << 1) | rfbit;
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
+         if (RawSignal->Pulses[x + 1] * RawSignal->Multiply < 600)
             x++;
       }
       else
       {
          bitstream = (bitstream << 1) | rfbit; // short pulse keep bit value
-         if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 600)
+         if (RawSignal->Pulses[x + 1] * RawSignal->Multiply < 600)
             x++;
       }
    }
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (Repeat_Seen(PLUGIN_ID(063), bitstream, 2250))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // calculate sensor and channel
    bitstream = (bitstream) >> 4;
@@ -100,8 +94,7 @@ boolean Plugin_063(byte function, char *string)
    display_CMD(CMD_Single, CMD_On);        // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_063
@@ -22,6 +22,7 @@
 
 #define ATLANTIC_PLUGIN_ID 064
 #define PLUGIN_DESC_064 "Atlantic"
+#define PLUGIN_PULSES_064 {ATLANTIC_PULSECOUNT, ATLANTIC_PULSECOUNT}
 #define ATLANTIC_PULSECOUNT 74
 
 #define ATLANTIC_PULSE_MID 600 / RAWSIGNAL_SAMPLE_RATE
@@ -30,10 +31,11 @@
 
 #ifdef PLUGIN_064
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_064(byte function, char *string)
+boolean Plugin_064(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != ATLANTIC_PULSECOUNT)
+   if (RawSignal->Number != ATLANTIC_PULSECOUNT)
       return false;
 
    unsigned long bitstream = 0L; // Only the 32 first bits are processed
@@ -45,19 +47,19 @@ boolean Plugin_064(byte function, char *string)
 
    for (byte x = 2; x <= 64; x += 2)
    {
-      if (RawSignal.Pulses[x] > ATLANTIC_PULSE_MID)
+      if (RawSignal->Pulses[x] > ATLANTIC_PULSE_MID)
       { // long pulse = 1
-         if (RawSignal.Pulses[x] > ATLANTIC_PULSE_MAX)
+         if (RawSignal->Pulses[x] > ATLANTIC_PULSE_MAX)
             return false; // pulse too long
-         if (RawSignal.Pulses[x + 1] > ATLANTIC_PULSE_MAX)
+         if (RawSignal->Pulses[x + 1] > ATLANTIC_PULSE_MAX)
             return false; // invalid manchester code
          bitstream = (bitstream << 1) | 0x1;
       }
       else
       { // short pulse = 0
-         if (RawSignal.Pulses[x] < ATLANTIC_PULSE_MIN)
+         if (RawSignal->Pulses[x] < ATLANTIC_PULSE_MIN)
             return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] < ATLANTIC_PULSE_MID)
+         if (RawSignal->Pulses[x + 1] < ATLANTIC_PULSE_MID)
             return false; // invalid manchester code
          bitstream = bitstream << 1;
       }
@@ -65,9 +67,7 @@ boolean Plugin_064(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;
-   else
+   if (Repeat_Seen(PLUGIN_ID(064), bitstream, 950))
       return true; // packet already seen
    //==================================================================================
    // Extract data
@@ -84,8 +84,7 @@ boolean Plugin_064(byte function, char *string)
    display_CMD(CMD_Single, alarm ? CMD_On : CMD_Off);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // Plugin_064
@@ -44,6 +44,7 @@
  \*********************************************************************************************/
 #define SELECTPLUS_PLUGIN_ID 070
 #define PLUGIN_DESC_070 "SelectPlus"
+#define PLUGIN_PULSES_070 {SELECTPLUS_PULSECOUNT, SELECTPLUS_PULSECOUNT}
 #define SELECTPLUS_PULSECOUNT 36
 
 #define SELECTPLUS_PULSEMID 650 / RAWSIGNAL_SAMPLE_RATE
@@ -51,10 +52,11 @@
 
 #ifdef PLUGIN_070
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_070(byte function, char *string)
+boolean Plugin_070(byte function, const RawSignalStruct *RawSignal)
 {
-    if (RawSignal.Number != SELECTPLUS_PULSECOUNT)
+    if (RawSignal->Number != SELECTPLUS_PULSECOUNT)
         return false;
 
     unsigned long bitstream = 0L;
@@ -65,17 +67,17 @@ boolean Plugin_070(byte function, char *string)
     for (byte x = 2; x < SELECTPLUS_PULSECOUNT; x = x + 2)
     {
         bitstream <<= 1; // Always shift
-        if (RawSignal.Pulses[x] < SELECTPLUS_PULSEMID)
+        if (RawSignal->Pulses[x] < SELECTPLUS_PULSEMID)
         {
-            if (RawSignal.Pulses[x + 1] < SELECTPLUS_PULSEMID)
+            if (RawSignal->Pulses[x + 1] < SELECTPLUS_PULSEMID)
                 return false; // invalid pulse sequence 10/01
             // bitstream |= 0x0;
         }
         else
         {
-            if (RawSignal.Pulses[x] > SELECTPLUS_PULSEMAX)
+            if (RawSignal->Pulses[x] > SELECTPLUS_PULSEMAX)
                 return false; // invalid pulse duration, pulse too long
-            if (RawSignal.Pulses[x + 1] > SELECTPLUS_PULSEMID)
+            if (RawSignal->Pulses[x + 1] > SELECTPLUS_PULSEMID)
                 return false; // invalid pulse sequence 10/01
             bitstream |= 0x1;
         }
@@ -88,9 +90,7 @@ boolean Plugin_070(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (Repeat_Seen(PLUGIN_ID(070), bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // all bytes received, make sure checksum is okay
@@ -109,8 +109,7 @@ boolean Plugin_070(byte function, char *string)
     display_CHIME(1);
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;     // do not process the packet any further
+    PluginResult.Quiet = true; // suppress repeats of the same RF packet
     return true;
 }
 #endif // PLUGIN_070
@@ -37,44 +37,34 @@
  \*********************************************************************************************/
 #define PLIEGER_PLUGIN_ID 071
 #define PLUGIN_DESC_071 "Plieger"
+#define PLUGIN_PULSES_071 {PLIEGER_PULSECOUNT, PLIEGER_PULSECOUNT}
 
 #define PLIEGER_PULSECOUNT 66
 
-#define PLIEGER_PULSEMID 700 / RAWSIGNAL_SAMPLE_RATE
-#define PLIEGER_PULSEMAX 1900 / RAWSIGNAL_SAMPLE_RATE
+#define PLIEGER_SHORT 300
+#define PLIEGER_LONG 1100
+#define PLIEGER_TOLERANCE 800 // Long up to 1900, short with no lower bound
 
 #ifdef PLUGIN_071
 #include "../4_Display.h"
+#include "../5_Repeat.h"
+#include "../5_LineCode.h"
 
-boolean Plugin_071(byte function, char *string)
+boolean Plugin_071(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != PLIEGER_PULSECOUNT)
+   if (RawSignal->Number != PLIEGER_PULSECOUNT)
       return false;
 
+   LineBits<32> bits;
    unsigned long bitstream = 0L;
    unsigned int id = 0;
    byte chime = 0;
    //==================================================================================
    // Get all 32 bits
    //==================================================================================
-   for (byte x = 1; x <= PLIEGER_PULSECOUNT - 2; x += 2)
-   {
-      bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] > PLIEGER_PULSEMID)
-      {
-         if (RawSignal.Pulses[x] > PLIEGER_PULSEMAX)
-            return false;
-         if (RawSignal.Pulses[x + 1] > PLIEGER_PULSEMID)
-            return false; // Valid Manchester check
-         bitstream |= 0x1;
-      }
-      else
-      {
-         if (RawSignal.Pulses[x + 1] < PLIEGER_PULSEMID)
-            return false; // Valid Manchester check
-         // bitstream |= 0x0;
-      }
-   }
+   if (!PwmDecoder<PLIEGER_SHORT, PLIEGER_LONG, PLIEGER_TOLERANCE>::Decode(RawSignal, 1, bits))
+      return false; // Valid Manchester check
+   bitstream = bits.Value(0, 32);
    //==================================================================================
    // Perform a quick sanity check
    //==================================================================================
@@ -85,9 +75,7 @@ boolean Plugin_071(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(071), bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    id = ((bitstream >> 16) & 0xFFFF); // get 16 bits unique address
@@ -117,8 +105,7 @@ boolean Plugin_071(byte function, char *string)
    display_CHIME(chime);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_071
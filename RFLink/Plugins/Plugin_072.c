@@ -31,6 +31,7 @@
  \*********************************************************************************************/
 #define BYRON_PLUGIN_ID 072
 #define PLUGIN_DESC_072 "Byron SX"
+#define PLUGIN_PULSES_072 {BYRON_PULSECOUNT, BYRON_PULSECOUNT}
 
 #define BYRON_PULSECOUNT 26
 
@@ -41,14 +42,15 @@
 
 #ifdef PLUGIN_072
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_072(byte function, char *string)
+boolean Plugin_072(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != BYRON_PULSECOUNT)
+   if (RawSignal->Number != BYRON_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] != BYRON_PLUGIN_ID)
+   if (RawSignal->Pulses[0] != PLUGIN_ID(072))
       return false; // only accept plugin1 translated packets
-   if (RawSignal.Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 425)
+   if (RawSignal->Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 425)
       return false; // first pulse is start bit and must be short
 
    unsigned long bitstream = 0L;
@@ -58,21 +60,21 @@ boolean Plugin_072(byte function, char *string)
    for (byte x = 2; x < BYRON_PULSECOUNT; x += 2)
    {
       bitstream <<= 1; // Always shift
-      if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 350)
+      if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 350)
       { // 200-275 (150-350 is accepted)
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 150)
+         if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 150)
             return false; // pulse too short
-         if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 350)
+         if (RawSignal->Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 350)
             return false; // bad manchester code
          // bitstream |= 0x0;
       }
       else
       { // 500-575 (450-650 is accepted)
-         if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 450)
+         if (RawSignal->Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 450)
             return false; // bad manchester code
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 450)
+         if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 450)
             return false; // pulse too short
-         if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 650)
+         if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 650)
             return false; // pulse too long
          bitstream |= 0x1;
       }
@@ -85,9 +87,7 @@ boolean Plugin_072(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(072), bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -100,8 +100,7 @@ boolean Plugin_072(byte function, char *string)
    display_CHIME((bitstream & 0xF));
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_072
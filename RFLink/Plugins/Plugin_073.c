@@ -33,23 +33,27 @@
  \*********************************************************************************************/
 #define DELTRONIC_PLUGIN_ID 073
 #define PLUGIN_DESC_073 "Deltronic"
+#define PLUGIN_PULSES_073 {DELTRONIC_PULSECOUNT, DELTRONIC_PULSECOUNT}
 
 #define DELTRONIC_PULSECOUNT 26
 
 #define LENGTH_DEVIATION 300
+#define DELTRONIC_SPACE_MIN 250  // Shortest first half of a bit
+#define DELTRONIC_SPACE_MAX 1275 // Longest first half of a bit
 
 #ifdef PLUGIN_073
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_073(byte function, char *string)
+boolean Plugin_073(byte function, const RawSignalStruct *RawSignal)
 {
-    if (RawSignal.Number != DELTRONIC_PULSECOUNT)
+    if (RawSignal->Number != DELTRONIC_PULSECOUNT)
         return false;
 
     unsigned long bitstream = 0L;
     unsigned long checksum = 0L;
     //==================================================================================
-    if (RawSignal.Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 675)
+    if (RawSignal->Pulses[1] * RAWSIGNAL_SAMPLE_RATE > 675)
         return false; // First pulse is start bit and should be short!
                       //==================================================================================
                       // Get all 12 bits
@@ -57,20 +61,20 @@ boolean Plugin_073(byte function, char *string)
     for (byte x = 2; x < DELTRONIC_PULSECOUNT; x = x + 2)
     {
         bitstream <<= 1; // Always shift
-        if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 800)
+        if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 800)
         { // long pulse  (800-1275)
-            if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE > 1275)
+            if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE > DELTRONIC_SPACE_MAX)
                 return false; // pulse too long to be valid
-            if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 675)
+            if (RawSignal->Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE > 675)
                 return false; // invalid manchestercode (10 01)
 
             bitstream |= 0x1; // 10 => 1 bit
         }
         else
         { // short pulse
-            if (RawSignal.Pulses[x] * RAWSIGNAL_SAMPLE_RATE < 250)
+            if (RawSignal->Pulses[x] * RAWSIGNAL_SAMPLE_RATE < DELTRONIC_SPACE_MIN)
                 return false; // too short
-            if (RawSignal.Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 700)
+            if (RawSignal->Pulses[x + 1] * RAWSIGNAL_SAMPLE_RATE < 700)
                 return false; // invalid manchestercode (10 01)
 
             // bitstream |= 0x0; // 01 => 0 bit
@@ -87,9 +91,7 @@ boolean Plugin_073(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (Repeat_Seen(PLUGIN_ID(073), bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
@@ -102,8 +104,7 @@ boolean Plugin_073(byte function, char *string)
     display_CHIME(1);
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;     // do not process the packet any further
+    PluginResult.Quiet = true; // suppress repeats of the same RF packet
     return true;
 }
 #endif // PLUGIN_073
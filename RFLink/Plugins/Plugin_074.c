@@ -35,6 +35,7 @@
  \*********************************************************************************************/
 #define RL02_PLUGIN_ID 074
 #define PLUGIN_DESC_074 "Byron MP"
+#define PLUGIN_PULSES_074 {(RL02_CodeLength * 4) + 2, (RL02_CodeLength * 4) + 2}
 
 #define RL02_CodeLength 12
 
@@ -42,10 +43,11 @@
 
 #ifdef PLUGIN_074
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_074(byte function, char *string)
+boolean Plugin_074(byte function, const RawSignalStruct *RawSignal)
 {
-    if (RawSignal.Number != (RL02_CodeLength * 4) + 2)
+    if (RawSignal->Number != (RL02_CodeLength * 4) + 2)
         return false;
 
     unsigned long bitstream = 0L;
@@ -57,16 +59,16 @@ boolean Plugin_074(byte function, char *string)
     for (byte i = 0; i < RL02_CodeLength; i++)
     {
 
-        if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+        if (RawSignal->Pulses[4 * i + 1] < j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] < j && RawSignal->Pulses[4 * i + 4] > j)
         {                    // 0101
             bitstream >>= 1; // 0
         }
-        else if (RawSignal.Pulses[4 * i + 1] < j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+        else if (RawSignal->Pulses[4 * i + 1] < j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] > j && RawSignal->Pulses[4 * i + 4] < j)
         {
             bitstream >>= 1;                           // 0110
             bitstream |= (1 << (RL02_CodeLength - 1)); // 1
         }
-        else if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] < j && RawSignal.Pulses[4 * i + 3] > j && RawSignal.Pulses[4 * i + 4] < j)
+        else if (RawSignal->Pulses[4 * i + 1] > j && RawSignal->Pulses[4 * i + 2] < j && RawSignal->Pulses[4 * i + 3] > j && RawSignal->Pulses[4 * i + 4] < j)
         {                    // 1010
             bitstream >>= 1; // 0
         }
@@ -74,7 +76,7 @@ boolean Plugin_074(byte function, char *string)
         {
             if (i == 0)
             {
-                if (RawSignal.Pulses[4 * i + 1] > j && RawSignal.Pulses[4 * i + 2] > j && RawSignal.Pulses[4 * i + 3] < j && RawSignal.Pulses[4 * i + 4] > j)
+                if (RawSignal->Pulses[4 * i + 1] > j && RawSignal->Pulses[4 * i + 2] > j && RawSignal->Pulses[4 * i + 3] < j && RawSignal->Pulses[4 * i + 4] > j)
                 {
                     bitstream >>= 1;                           // 1101
                     bitstream |= (1 << (RL02_CodeLength - 1)); // 1
@@ -97,9 +99,7 @@ boolean Plugin_074(byte function, char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (Repeat_Seen(PLUGIN_ID(074), bitstream, 1250))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
@@ -112,8 +112,7 @@ boolean Plugin_074(byte function, char *string)
     display_CHIME(1);
     display_Footer();
     // ----------------------------------
-    RawSignal.Repeats = true;
-    RawSignal.Number = 0;
+    PluginResult.Quiet = true;
     return true;
 }
 #endif //PLUGIN_074
@@ -38,16 +38,18 @@
 // ==================================================================================
 #define LIDL_PLUGIN_ID 075
 #define PLUGIN_DESC_075 "SilverCrest"
+#define PLUGIN_PULSES_075 {LIDL_PULSECOUNT, LIDL_PULSECOUNT}, {LIDL_PULSECOUNT2, LIDL_PULSECOUNT2}
 
 #define LIDL_PULSECOUNT 90   // type 0
 #define LIDL_PULSECOUNT2 114 // type 1
 
 #ifdef PLUGIN_075
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_075(byte function, char *string)
+boolean Plugin_075(byte function, const RawSignalStruct *RawSignal)
 {
-   if ((RawSignal.Number != LIDL_PULSECOUNT) && (RawSignal.Number != LIDL_PULSECOUNT2))
+   if ((RawSignal->Number != LIDL_PULSECOUNT) && (RawSignal->Number != LIDL_PULSECOUNT2))
       return false;
    unsigned long bitstream = 0;
    unsigned long bitstream2 = 0;
@@ -57,12 +59,12 @@ boolean Plugin_075(byte function, char *string)
    //==================================================================================
    // Get all 40 bits
    //==================================================================================
-   if (RawSignal.Number == LIDL_PULSECOUNT)
+   if (RawSignal->Number == LIDL_PULSECOUNT)
    {
-      if (RawSignal.Pulses[1] * RawSignal.Multiply > 1000 && RawSignal.Pulses[2] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[3] * RawSignal.Multiply > 1000 && RawSignal.Pulses[4] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[5] * RawSignal.Multiply > 1000 && RawSignal.Pulses[6] * RawSignal.Multiply > 1000 &&
-          RawSignal.Pulses[7] * RawSignal.Multiply > 1000 && RawSignal.Pulses[8] * RawSignal.Multiply > 1000 && RawSignal.Pulses[9] * RawSignal.Multiply > 1000)
+      if (RawSignal->Pulses[1] * RawSignal->Multiply > 1000 && RawSignal->Pulses[2] * RawSignal->Multiply > 1000 &&
+          RawSignal->Pulses[3] * RawSignal->Multiply > 1000 && RawSignal->Pulses[4] * RawSignal->Multiply > 1000 &&
+          RawSignal->Pulses[5] * RawSignal->Multiply > 1000 && RawSignal->Pulses[6] * RawSignal->Multiply > 1000 &&
+          RawSignal->Pulses[7] * RawSignal->Multiply > 1000 && RawSignal->Pulses[8] * RawSignal->Multiply > 1000 && RawSignal->Pulses[9] * RawSignal->Multiply > 1000)
       {
          //
       }
@@ -74,7 +76,7 @@ boolean Plugin_075(byte function, char *string)
          if (bitcount < 28)
          {
             bitstream <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (RawSignal->Pulses[x] * RawSignal->Multiply > 550)
             {
                // bitstream |= 0x0;
             }
@@ -87,7 +89,7 @@ boolean Plugin_075(byte function, char *string)
          else
          {
             bitstream2 <<= 1; // Always shift
-            if (RawSignal.Pulses[x] * RawSignal.Multiply > 550)
+            if (RawSignal->Pulses[x] * RawSignal->Multiply > 550)
             {
                // bitstream2 |= 0x0;
             }
@@ -101,14 +103,14 @@ boolean Plugin_075(byte function, char *string)
    }
    else
    {
-      if (RawSignal.Pulses[0] != LIDL_PLUGIN_ID)
+      if (RawSignal->Pulses[0] != PLUGIN_ID(075))
          return false; // only accept plugin1 translated packets
       type = 1;
       for (byte x = 1; x < LIDL_PULSECOUNT2 - 1; x += 2)
       {
-         if (RawSignal.Pulses[x] * RawSignal.Multiply > 200)
+         if (RawSignal->Pulses[x] * RawSignal->Multiply > 200)
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply > 200)
+            if (RawSignal->Pulses[x + 1] * RawSignal->Multiply > 200)
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -122,7 +124,7 @@ boolean Plugin_075(byte function, char *string)
          }
          else
          {
-            if (RawSignal.Pulses[x + 1] * RawSignal.Multiply < 200)
+            if (RawSignal->Pulses[x + 1] * RawSignal->Multiply < 200)
                return false; // invalid pulse length
             if (bitcount > 23)
             {
@@ -154,9 +156,7 @@ boolean Plugin_075(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(075), bitstream, 1250))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -172,8 +172,7 @@ boolean Plugin_075(byte function, char *string)
    display_CHIME(1);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_075_CORE
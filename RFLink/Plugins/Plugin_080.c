@@ -36,6 +36,7 @@
  \*********************************************************************************************/
 #define FA20_PLUGIN_ID 080
 #define PLUGIN_DESC_080 "FA20RF"
+#define PLUGIN_PULSES_080 {FA20_PULSECOUNT, FA20_PULSECOUNT}
 
 #define FA20_PULSECOUNT 52
 
@@ -48,9 +49,9 @@
 #ifdef PLUGIN_080
 #include "../4_Display.h"
 
-boolean Plugin_080(byte function, char *string)
+boolean Plugin_080(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != FA20_PULSECOUNT)
+   if (RawSignal->Number != FA20_PULSECOUNT)
       return false;
       
    unsigned long bitstream = 0L;
@@ -59,22 +60,22 @@ boolean Plugin_080(byte function, char *string)
    //==================================================================================
    for (byte x = 4; x < FA20_PULSECOUNT; x += 2)
    {
-      if (RawSignal.Pulses[x - 1] > FA20_MIDHI)
+      if (RawSignal->Pulses[x - 1] > FA20_MIDHI)
          return false; // every preceding pulse must be below 1000!
 
       bitstream <<= 1;
 
-      if (RawSignal.Pulses[x] > FA20_PULSEMAXMIN)
+      if (RawSignal->Pulses[x] > FA20_PULSEMAXMIN)
       { // long pulse
-         if (RawSignal.Pulses[x] > FA20_PULSEMAX)
+         if (RawSignal->Pulses[x] > FA20_PULSEMAX)
             return false; // long pulse too long
          bitstream |= 0x1;
       }
       else
       {
-         if (RawSignal.Pulses[x] > FA20_PULSEMINMAX)
+         if (RawSignal->Pulses[x] > FA20_PULSEMINMAX)
             return false; // short pulse too long
-         if (RawSignal.Pulses[x] < FA20_PULSEMIN)
+         if (RawSignal->Pulses[x] < FA20_PULSEMIN)
             return false; // short pulse too short
          // bitstream |= 0x0;
       }
@@ -97,8 +98,7 @@ boolean Plugin_080(byte function, char *string)
    display_SMOKEALERT(SMOKE_On);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_080
@@ -42,6 +42,7 @@
  \*********************************************************************************************/
 #define MAXITROL1_PLUGIN_ID 081
 #define PLUGIN_DESC_081 "Mertik"
+#define PLUGIN_PULSES_081 {MAXITROL1_PULSECOUNT, MAXITROL1_PULSECOUNT}
 
 #define MAXITROL1_PULSECOUNT 46
 
@@ -51,10 +52,11 @@
 
 #ifdef PLUGIN_081
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_081(byte function, char *string)
+boolean Plugin_081(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != MAXITROL1_PULSECOUNT)
+   if (RawSignal->Number != MAXITROL1_PULSECOUNT)
       return false;
 
    unsigned int bitstream = 0L;
@@ -64,9 +66,9 @@ boolean Plugin_081(byte function, char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[1] > MAXITROL1_PULSEMINMAX)
+   if (RawSignal->Pulses[1] > MAXITROL1_PULSEMINMAX)
       return false;
-   if (RawSignal.Pulses[2] > MAXITROL1_MID)
+   if (RawSignal->Pulses[2] > MAXITROL1_MID)
       return false;
    //==================================================================================
    // Get all 22 bits
@@ -75,17 +77,17 @@ boolean Plugin_081(byte function, char *string)
    {
       bitstream <<= 1; // Always shift
 
-      if (RawSignal.Pulses[x] < MAXITROL1_PULSEMINMAX)
+      if (RawSignal->Pulses[x] < MAXITROL1_PULSEMINMAX)
       {
-         if (RawSignal.Pulses[x + 1] < MAXITROL1_MID)
+         if (RawSignal->Pulses[x + 1] < MAXITROL1_MID)
             return false;
          // bitstream |= 0x0; // 0
       }
       else
       {
-         if (RawSignal.Pulses[x] > MAXITROL1_PULSEMAX)
+         if (RawSignal->Pulses[x] > MAXITROL1_PULSEMAX)
             return false;
-         if (RawSignal.Pulses[x + 1] > MAXITROL1_MID)
+         if (RawSignal->Pulses[x + 1] > MAXITROL1_MID)
             return false;
          bitstream |= 0x1; // 1
       }
@@ -98,9 +100,7 @@ boolean Plugin_081(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(081), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
@@ -166,8 +166,7 @@ boolean Plugin_081(byte function, char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_081
@@ -42,6 +42,7 @@
  \*********************************************************************************************/
 #define MAXITROL2_PLUGIN_ID 082
 #define PLUGIN_DESC_082 "Mertik v2"
+#define PLUGIN_PULSES_082 {MAXITROL2_PULSECOUNT, MAXITROL2_PULSECOUNT}
 
 #define MAXITROL2_PULSECOUNT 26
 
@@ -51,10 +52,11 @@
 
 #ifdef PLUGIN_082
 #include "../4_Display.h"
+#include "../5_Repeat.h"
 
-boolean Plugin_082(byte function, char *string)
+boolean Plugin_082(byte function, const RawSignalStruct *RawSignal)
 {
-   if (RawSignal.Number != MAXITROL2_PULSECOUNT)
+   if (RawSignal->Number != MAXITROL2_PULSECOUNT)
       return false;
 
    unsigned int bitstream = 0L;
@@ -64,9 +66,9 @@ boolean Plugin_082(byte function, char *string)
    //==================================================================================
    // Perform a pre sanity check
    //==================================================================================
-   if (RawSignal.Pulses[1] > MAXITROL2_PULSEMINMAX)
+   if (RawSignal->Pulses[1] > MAXITROL2_PULSEMINMAX)
       return false;
-   if (RawSignal.Pulses[2] > MAXITROL2_MID)
+   if (RawSignal->Pulses[2] > MAXITROL2_MID)
       return false;
    //==================================================================================
    // Get all 22 bits
@@ -75,17 +77,17 @@ boolean Plugin_082(byte function, char *string)
    {
       bitstream <<= 1; // Always shift
 
-      if (RawSignal.Pulses[x] < MAXITROL2_PULSEMINMAX)
+      if (RawSignal->Pulses[x] < MAXITROL2_PULSEMINMAX)
       {
-         if (RawSignal.Pulses[x + 1] < MAXITROL2_MID)
+         if (RawSignal->Pulses[x + 1] < MAXITROL2_MID)
             return false;
          // bitstream |= 0x0; // 0
       }
       else
       {
-         if (RawSignal.Pulses[x] > MAXITROL2_PULSEMAX)
+         if (RawSignal->Pulses[x] > MAXITROL2_PULSEMAX)
             return false;
-         if (RawSignal.Pulses[x + 1] > MAXITROL2_MID)
+         if (RawSignal->Pulses[x + 1] > MAXITROL2_MID)
             return false;
          bitstream |= 0x1; // 1
       }
@@ -98,9 +100,7 @@ boolean Plugin_082(byte function, char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (Repeat_Seen(PLUGIN_ID(082), bitstream, 750))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
@@ -166,8 +166,7 @@ boolean Plugin_082(byte function, char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
+   PluginResult.Quiet = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif // PLUGIN_082
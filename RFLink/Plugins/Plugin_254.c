@@ -21,18 +21,19 @@
  \*********************************************************************************************/
 #define P254_PLUGIN_ID 254
 #define PLUGIN_DESC_254 "Unidentified Packet debugging"
+#define PLUGIN_PULSES_254 // Any length, PLUGIN_ANY_LENGTH
 
 #ifdef PLUGIN_254
 #include "../4_Display.h"
 
-boolean Plugin_254(byte function, char *string)
+boolean Plugin_254(byte function, const RawSignalStruct *RawSignal)
 {
    int i;
 
    if ((RFUDebug == false) && (QRFUDebug == false)) // debug is on?
       return false;
 
-   if (RawSignal.Number < 24) // make sure the packet is long enough to have a meaning
+   if (RawSignal->Number < 24) // make sure the packet is long enough to have a meaning
       return false;
 
    // ----------------------------------
@@ -43,28 +44,32 @@ boolean Plugin_254(byte function, char *string)
    display_Footer();
    // ----------------------------------
    Serial.print(F("20;XX;DEBUG;Pulses=")); // debug data
-   Serial.print(RawSignal.Number);         // print number of pulses
+   Serial.print(RawSignal->Number);         // print number of pulses
    Serial.print(F(";Pulses(uSec)="));      // print pulse durations
    // ----------------------------------
    char dbuffer[3];
 
-   for (i = 1; i < RawSignal.Number + 1; i++)
+   for (i = 1; i < RawSignal->Number + 1; i++)
    {
       if (QRFUDebug == true)
       {
-         sprintf(dbuffer, "%02x", RawSignal.Pulses[i]);
+         sprintf(dbuffer, "%02x", RawSignal->Pulses[i]);
          Serial.print(dbuffer);
       }
       else
       {
-         Serial.print(RawSignal.Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
-         if (i < RawSignal.Number)
+         Serial.print(RawSignal->Pulses[i] * RAWSIGNAL_SAMPLE_RATE);
+         if (i < RawSignal->Number)
             Serial.write(',');
       }
    }
+   if (RawSignal->Repairs)
+   {
+      Serial.print(F(";Repairs=")); // spikes merged while receiving
+      Serial.print(RawSignal->Repairs);
+   }
    Serial.print(F(";\r\n"));
    // ----------------------------------
-   RawSignal.Number = 0; // Last plugin, kill packet
    return true;          // stop processing
 }
 #endif // PLUGIN_254
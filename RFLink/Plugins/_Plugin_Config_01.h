@@ -11,7 +11,7 @@
 // Here are all plugins listed that are supported and used after compilation.
 // When needed additional plugins can be added or selected plugins can be enabled/disabled.
 //
-// BEWARE OF THE PLUGIN_MAX setting!!       TX: 51      RX: 24
+// The plugin table (5_Plugin.cpp) is built at compile time from the entries of _Plugin_List.h defined here, no size to set.
 // ****************************************************************************************************************************************
 // Translation Plugin for oversized packets due to their breaks/pause being too short between packets
 // Used for Flamingo FA500R and various others, do NOT exclude this plugin.
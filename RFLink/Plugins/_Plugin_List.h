@@ -0,0 +1,213 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// ****************************************************************************************************************************************
+// RFLink plugins known to the firmware, in the order of Plugin_Table[]
+// ****************************************************************************************************************************************
+// Each entry is built in when its PLUGIN_xxx is defined in _Plugin_Config_01.h:
+//   #include PLUGIN_SOURCE(xxx)   its source, Plugin_xxx.c
+//   PLUGIN(xxx, flags)            its rows in the tables of 5_Plugin.cpp, flags as in PluginDescriptor
+// 5_Plugin.cpp includes this file once per pass, with both macros defined for that pass (no include guard).
+// Its transmit function is taken when PLUGIN_TX_xxx is defined as well.
+// A new plugin needs its entry here, its PLUGIN_DESC_xxx and PLUGIN_PULSES_xxx, nothing else.
+// ****************************************************************************************************************************************
+#ifdef PLUGIN_001
+#include PLUGIN_SOURCE(001)
+PLUGIN(001, PLUGIN_ANY_LENGTH)
+#endif
+#ifdef PLUGIN_002
+#include PLUGIN_SOURCE(002)
+PLUGIN(002, 0)
+#endif
+#ifdef PLUGIN_003
+#include PLUGIN_SOURCE(003)
+PLUGIN(003, 0)
+#endif
+#ifdef PLUGIN_004
+#include PLUGIN_SOURCE(004)
+PLUGIN(004, 0)
+#endif
+#ifdef PLUGIN_005
+#include PLUGIN_SOURCE(005)
+PLUGIN(005, 0)
+#endif
+#ifdef PLUGIN_006
+#include PLUGIN_SOURCE(006)
+PLUGIN(006, 0)
+#endif
+#ifdef PLUGIN_007
+#include PLUGIN_SOURCE(007)
+PLUGIN(007, 0)
+#endif
+#ifdef PLUGIN_008
+#include PLUGIN_SOURCE(008)
+PLUGIN(008, 0)
+#endif
+#ifdef PLUGIN_009
+#include PLUGIN_SOURCE(009)
+PLUGIN(009, 0)
+#endif
+#ifdef PLUGIN_010
+#include PLUGIN_SOURCE(010)
+PLUGIN(010, 0)
+#endif
+#ifdef PLUGIN_011
+#include PLUGIN_SOURCE(011)
+PLUGIN(011, 0)
+#endif
+#ifdef PLUGIN_012
+#include PLUGIN_SOURCE(012)
+PLUGIN(012, 0)
+#endif
+#ifdef PLUGIN_013
+#include PLUGIN_SOURCE(013)
+PLUGIN(013, 0)
+#endif
+#ifdef PLUGIN_014
+#include PLUGIN_SOURCE(014)
+PLUGIN(014, 0)
+#endif
+#ifdef PLUGIN_015
+#include PLUGIN_SOURCE(015)
+PLUGIN(015, 0)
+#endif
+#ifdef PLUGIN_029
+#include PLUGIN_SOURCE(029)
+PLUGIN(029, 0)
+#endif
+#ifdef PLUGIN_030
+#include PLUGIN_SOURCE(030)
+PLUGIN(030, 0)
+#endif
+#ifdef PLUGIN_031
+#include PLUGIN_SOURCE(031)
+PLUGIN(031, 0)
+#endif
+#ifdef PLUGIN_032
+#include PLUGIN_SOURCE(032)
+PLUGIN(032, 0)
+#endif
+#ifdef PLUGIN_033
+#include PLUGIN_SOURCE(033)
+PLUGIN(033, 0)
+#endif
+#ifdef PLUGIN_034
+#include PLUGIN_SOURCE(034)
+PLUGIN(034, 0)
+#endif
+#ifdef PLUGIN_035
+#include PLUGIN_SOURCE(035)
+PLUGIN(035, 0)
+#endif
+#ifdef PLUGIN_036
+#include PLUGIN_SOURCE(036)
+PLUGIN(036, 0)
+#endif
+#ifdef PLUGIN_040
+#include PLUGIN_SOURCE(040)
+PLUGIN(040, 0)
+#endif
+#ifdef PLUGIN_041
+#include PLUGIN_SOURCE(041)
+PLUGIN(041, 0)
+#endif
+#ifdef PLUGIN_042
+#include PLUGIN_SOURCE(042)
+PLUGIN(042, 0)
+#endif
+#ifdef PLUGIN_043
+#include PLUGIN_SOURCE(043)
+PLUGIN(043, 0)
+#endif
+#ifdef PLUGIN_044
+#include PLUGIN_SOURCE(044)
+PLUGIN(044, 0)
+#endif
+#ifdef PLUGIN_045
+#include PLUGIN_SOURCE(045)
+PLUGIN(045, 0)
+#endif
+#ifdef PLUGIN_046
+#include PLUGIN_SOURCE(046)
+PLUGIN(046, 0)
+#endif
+#ifdef PLUGIN_047
+#include PLUGIN_SOURCE(047)
+PLUGIN(047, 0)
+#endif
+#ifdef PLUGIN_050
+#include PLUGIN_SOURCE(050)
+PLUGIN(050, 0)
+#endif
+#ifdef PLUGIN_051
+#include PLUGIN_SOURCE(051)
+PLUGIN(051, 0)
+#endif
+#ifdef PLUGIN_052
+#include PLUGIN_SOURCE(052)
+PLUGIN(052, 0)
+#endif
+#ifdef PLUGIN_060
+#include PLUGIN_SOURCE(060)
+PLUGIN(060, 0)
+#endif
+#ifdef PLUGIN_061
+#include PLUGIN_SOURCE(061)
+PLUGIN(061, 0)
+#endif
+#ifdef PLUGIN_062
+#include PLUGIN_SOURCE(062)
+PLUGIN(062, 0)
+#endif
+#ifdef PLUGIN_063
+#include PLUGIN_SOURCE(063)
+PLUGIN(063, 0)
+#endif
+#ifdef PLUGIN_064
+#include PLUGIN_SOURCE(064)
+PLUGIN(064, 0)
+#endif
+#ifdef PLUGIN_070
+#include PLUGIN_SOURCE(070)
+PLUGIN(070, 0)
+#endif
+#ifdef PLUGIN_071
+#include PLUGIN_SOURCE(071)
+PLUGIN(071, 0)
+#endif
+#ifdef PLUGIN_072
+#include PLUGIN_SOURCE(072)
+PLUGIN(072, 0)
+#endif
+#ifdef PLUGIN_073
+#include PLUGIN_SOURCE(073)
+PLUGIN(073, 0)
+#endif
+#ifdef PLUGIN_074
+#include PLUGIN_SOURCE(074)
+PLUGIN(074, 0)
+#endif
+#ifdef PLUGIN_075
+#include PLUGIN_SOURCE(075)
+PLUGIN(075, 0)
+#endif
+#ifdef PLUGIN_080
+#include PLUGIN_SOURCE(080)
+PLUGIN(080, 0)
+#endif
+#ifdef PLUGIN_081
+#include PLUGIN_SOURCE(081)
+PLUGIN(081, 0)
+#endif
+#ifdef PLUGIN_082
+#include PLUGIN_SOURCE(082)
+PLUGIN(082, 0)
+#endif
+#ifdef PLUGIN_254
+#include PLUGIN_SOURCE(254)
+PLUGIN(254, PLUGIN_ANY_LENGTH)
+#endif
@@ -0,0 +1,8 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Nothing: PLUGIN_SOURCE() of the passes over _Plugin_List.h that only build tables, the sources are in already.
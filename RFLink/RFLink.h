@@ -25,8 +25,9 @@
 
 // MQTT messages
 #define MQTT_ENABLED          // Send RFLink messages over MQTT
-#define MQTT_LOOP_MS 1000     // MQTTClient.loop(); call period (in mSec)
+#define MQTT_LOOP_MS 100      // MQTTClient.loop(); call period (in mSec), incoming commands wait at most that long
 #define MQTT_RETAINED_0 false // Retained option
+#define MQTT_JSON_0 false     // Decoded events as JSON to <MQTT_TOPIC_OUT>/<protocol>/<id>[/<switch>], see 4_Event.h
 #endif
 
 // Debug default
@@ -36,5 +37,7 @@
 #define QRFUDebug_0 false // debug RF signals with plugin 254 but no multiplication (faster?, compact)
 
 void CallReboot(void);
+void sendMsg();  // Queue pbuffer and the decoded event for every output, then clear them, see 4_Queue.h
+void flushMsg(); // Send what is queued, waiting for the outputs that can take it
 
 #endif
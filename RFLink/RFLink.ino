@@ -22,8 +22,11 @@
 #include "2_Signal.h"
 #include "3_Serial.h"
 #include "4_Display.h"
+#include "4_Event.h"
+#include "4_Queue.h"
 #include "5_Plugin.h"
 #include "6_WiFi_MQTT.h"
+#include "7_Scheduler.h"
 #include "8_OLED.h"
 #include "9_AutoConnect.h"
 
@@ -31,7 +34,12 @@
 #include <avr/power.h>
 #endif
 //****************************************************************************************************************************************
-void sendMsg(); // See at bottom
+boolean task_RF();
+boolean task_Serial();
+boolean task_MQTT();
+boolean task_Web();
+boolean task_Send();
+static boolean sendQueued(boolean wait);
 
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
 void (*Reboot)(void) = 0; // reset function on adress 0.
@@ -39,6 +47,7 @@ void (*Reboot)(void) = 0; // reset function on adress 0.
 void CallReboot(void)
 {
   sendMsg();
+  flushMsg();
   delay(1);
   Reboot();
 }
@@ -48,6 +57,7 @@ void CallReboot(void)
 void CallReboot(void)
 {
   sendMsg();
+  flushMsg();
   delay(1);
   ESP.restart();
 }
@@ -125,62 +135,250 @@ void setup()
   splash_OLED();
 #endif
 #ifdef MQTT_ENABLED
-  publishMsg();
+  publishMsg(pbuffer, Msg.Length);
 #endif
-  pbuffer[0] = 0;
+  Msg.Clear();
   set_Radio_mode(Radio_RX);
+
+  // loop() tasks: period (mSec), budget (uSec), priority (higher first)
+#if (defined(ESP32) || defined(ESP8266))
+  Task_Add(PSTR("RF"), task_RF, 2, 8000, 3); // Edges wait in the capture ring meanwhile
+#else
+  Task_Add(PSTR("RF"), task_RF, 1, SCAN_BUDGET_MS * 1000UL, 3); // Polls the receiver, one packet per call
+#endif
+  Task_Add(PSTR("Send"), task_Send, 5, 3000, 1); // Outputs catch up with the queue
+#ifdef SERIAL_ENABLED
+#if PIN_RF_TX_DATA_0 != NOT_A_PIN
+  Task_Add(PSTR("Serial"), task_Serial, 10, 2000, 2);
+#endif
+#endif
+#ifdef MQTT_ENABLED
+  Task_Add(PSTR("MQTT"), task_MQTT, MQTT_LOOP_MS, 5000, 1);
+#endif
+#ifdef AUTOCONNECT_ENABLED
+  Task_Add(PSTR("Web"), task_Web, 5, 5000, 0);
+#endif
 }
 
 void loop()
 {
+  Task_Run();
+}
+
 #ifdef AUTOCONNECT_ENABLED
-  loop_AutoConnect();
-  if (WiFi.status() == WL_CONNECTED)
-  {
+#define ONLINE() (WiFi.status() == WL_CONNECTED) // Only the portal runs until WiFi is connected
+#else
+#define ONLINE() true
 #endif
+
+boolean task_RF()
+{ // One packet (or frame of a repeat burst) per call
+  if (ONLINE() && ScanEvent())
+  {
+    sendMsg();
+    return true;
+  }
+  return false;
+}
+
+boolean task_Serial()
+{
+  if (ONLINE() && CheckSerial())
+  {
+    sendMsg();
+    return true;
+  }
+  return false;
+}
+
 #ifdef MQTT_ENABLED
+boolean task_MQTT()
+{
+  if (ONLINE())
+  {
     checkMQTTloop();
     sendMsg();
+  }
+  return false;
+}
 #endif
 
-#ifdef SERIAL_ENABLED
-#if PIN_RF_TX_DATA_0 != NOT_A_PIN
-    if (CheckSerial())
-      sendMsg();
+#ifdef AUTOCONNECT_ENABLED
+boolean task_Web()
+{
+  loop_AutoConnect();
+  if (ONLINE() && CheckWeb(CmdMsg))
+    sendMsg();
+  return false;
+}
 #endif
+
+boolean task_Send()
+{
+  return sendQueued(false);
+}
+
+// ----------------- //
+// Outputs           //
+// ----------------- //
+// Each sends its next queued message once it can take it without waiting, true when it did.
+// wait: the serial port takes it anyway (answers to commands, reboot).
+
+#ifdef SERIAL_ENABLED
+static boolean send_Serial(boolean wait)
+{
+  QueueSlot *slot = Queue_Peek(QUEUE_SERIAL);
+
+  if (!slot || (!wait && (Serial.availableForWrite() < QUEUE_SERIAL_ROOM)))
+    return false;
+  if (!slot->Decoded)
+    Serial.write((const uint8_t *)slot->Text, strlen(slot->Text));
+#ifdef QUEUE_RENDERED
+  else
+  { // Kept as an event for a binary frame only, see sendMsg()
+#else
+  else if (SerialBinary && (slot->Event.State == EVENT_READY))
+  {
 #endif
+    // Built as it is sent: a name is defined by the first frame that goes out with it
+    byte frame[EVENT_FRAME_SIZE];
 
-#ifdef AUTOCONNECT_ENABLED
-    if (CheckWeb(CmdMsg))
-      sendMsg();
+    Serial.write(frame, Event_Frame(frame, &slot->Event));
+  }
+#ifndef QUEUE_RENDERED
+  else
+  {
+    char text[PRINT_BUFFER_SIZE];
+    MessageBuilder text_out = {text, sizeof(text), 0, 0};
+
+    Serial.write((const uint8_t *)text, Queue_Text(slot, &text_out));
+  }
 #endif
+  Queue_Pop(QUEUE_SERIAL);
+  return true;
+}
+#endif
+
+#ifdef MQTT_ENABLED
+static boolean send_MQTT()
+{ // Kept while not connected, checkMQTTloop() reconnects
+  QueueSlot *slot = Queue_Peek(QUEUE_MQTT);
+  boolean sent;
 
-    if (ScanEvent())
-      sendMsg();
+  if (!slot)
+    return false;
+  if (MQTT_JSON && slot->Decoded && (slot->Event.State == EVENT_READY))
+    sent = publishEvent(&slot->Event);
+  else
+  {
+    char text[PRINT_BUFFER_SIZE];
+    MessageBuilder text_out = {text, sizeof(text), 0, 0};
 
-#ifdef AUTOCONNECT_ENABLED
+    sent = publishMsg(text, Queue_Text(slot, &text_out));
   }
+  if (sent)
+    Queue_Pop(QUEUE_MQTT);
+  return sent;
+}
 #endif
+
+#ifdef AUTOCONNECT_ENABLED
+static boolean send_Web()
+{
+  QueueSlot *slot = Queue_Peek(QUEUE_WEB);
+  char text[PRINT_BUFFER_SIZE];
+  MessageBuilder text_out = {text, sizeof(text), 0, 0};
+
+  if (!slot)
+    return false;
+  Queue_Text(slot, &text_out);
+  LastMsg = text;
+  Queue_Pop(QUEUE_WEB);
+  return true;
 }
+#endif
 
-void sendMsg()
+#ifdef OLED_ENABLED
+static boolean send_OLED()
 {
-  if (pbuffer[0] != 0)
-  {
+  QueueSlot *slot = Queue_Peek(QUEUE_OLED);
+  char text[PRINT_BUFFER_SIZE];
+  MessageBuilder text_out = {text, sizeof(text), 0, 0};
+
+  if (!slot)
+    return false;
+  Queue_Text(slot, &text_out);
+  print_OLED(text);
+  Queue_Pop(QUEUE_OLED);
+  return true;
+}
+#endif
+
+// One message to each output ready for it, true when one was sent
+static boolean sendQueued(boolean wait)
+{
+  boolean sent = false;
+
 #ifdef SERIAL_ENABLED
-    Serial.print(pbuffer);
+  sent |= send_Serial(wait);
 #endif
 #ifdef MQTT_ENABLED
-    publishMsg();
+  sent |= send_MQTT();
 #endif
 #ifdef AUTOCONNECT_ENABLED
-    LastMsg = pbuffer;
+  sent |= send_Web();
 #endif
 #ifdef OLED_ENABLED
-    print_OLED();
+  sent |= send_OLED();
+#endif
+  return sent;
+}
+
+void sendMsg()
+{
+  if (pbuffer[0] != 0)
+  { // Answers to commands are not dropped: wait for the outputs able to make room
+    while (Queue_Full() && sendQueued(true))
+      ;
+    QueueSlot *slot = Queue_Add();
+
+    slot->Decoded = false;
+    strcpy(slot->Text, pbuffer);
+  }
+  if (Event.State != EVENT_FREE)
+  { // Decoded event: an output a whole ring behind loses its oldest message
+#ifdef QUEUE_RENDERED
+    while (Queue_Full() && sendQueued(true))
+      ;
 #endif
-    pbuffer[0] = 0;
+    QueueSlot *slot = Queue_Add();
+
+#ifdef QUEUE_RENDERED
+    if (!SerialBinary || (Event.State != EVENT_READY))
+    { // Serial is the only output: its text, made once
+      MessageBuilder text_out = {slot->Text, sizeof(slot->Text), 0, 0};
+
+      text_out.Clear();
+      Event_Render(&text_out, &Event);
+      Msg.Overflows += text_out.Overflows;
+      slot->Decoded = false;
+    }
+    else
+#endif
+    {
+      slot->Decoded = true;
+      slot->Event = Event;
+    }
+    Event.State = EVENT_FREE;
   }
+  Msg.Clear();
+  sendQueued(false);
+}
+
+void flushMsg()
+{
+  while (sendQueued(true))
+    ;
 }
 
 /*********************************************************************************************/
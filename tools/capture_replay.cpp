@@ -0,0 +1,147 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host side runner for the packet assembler of RFLink/2_Capture.cpp
+//
+// Build:
+//   g++ -O2 -I../RFLink -o capture_replay capture_replay.cpp ../RFLink/2_Capture.cpp ../RFLink/2_Packed.cpp ../RFLink/2_Stats.cpp
+//
+// Usage:
+//   capture_replay <timeline.txt>  replay recorded edges ("<time_us> <level>" per line),
+//                                  print packets the way plugin 001 debug output does
+//   capture_replay -s <packets> [<jitter_us>]
+//                                  feed a synthetic 24 bit PWM frame with jitter,
+//                                  check captured pulses against programmed ones
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "2_Signal.h"
+#include "2_Capture.h"
+#include "2_Stats.h"
+
+#define SYNTH_JITTER_US 60 // 60         // +/- jitter applied on each synthetic period, unless given
+#define SYNTH_SHORT_US 400 // 400
+#define SYNTH_LONG_US 1200 // 1200
+#define SYNTH_GAP_US 9000  // 9000
+
+static unsigned long Packets = 0;
+static unsigned long Bytewise = 0; // Packets with too many distinct lengths for 4 bit symbols
+
+static void print_Packet(PackedSignalStruct *packet)
+{
+  printf("20;XX;DEBUG;Pulses=%d;Pulses(uSec)=", packet->Number);
+  for (int i = 1; i < packet->Number; i++)
+    printf("%d,", Packed_Pulse(packet, i) * RAWSIGNAL_SAMPLE_RATE);
+  printf("%d", Packed_Pulse(packet, packet->Number) * RAWSIGNAL_SAMPLE_RATE);
+  if (packet->Repairs)
+    printf(";Repairs=%d", packet->Repairs);
+  printf(";Widths=%d;\n", packet->Widths);
+}
+
+static void Replay(FILE *file)
+{
+  ReplayPulseSource source(file);
+  PackedSignalStruct *packet;
+  uint32_t time_us;
+  uint8_t level;
+
+  do
+  { // Capture_Poll() takes a bounded number of edges at a time
+    while ((packet = Capture_Poll(source)))
+    {
+      print_Packet(packet);
+      if (!packet->Widths)
+        Bytewise++;
+      Capture_Release(packet);
+      Packets++;
+    }
+  } while (source.Peek(time_us, level));
+}
+
+// Expected sample of a programmed period, as the assembler stores it
+static int Expected(uint32_t us)
+{
+  return (us / RAWSIGNAL_SAMPLE_RATE > 0xFF ? 0xFF : us / RAWSIGNAL_SAMPLE_RATE);
+}
+
+static void Synthetic(unsigned long count, uint16_t jitter_us)
+{
+  SyntheticPulseSource source(0, jitter_us);
+  const uint32_t code = 0xA5C33C;
+  unsigned long pulses = 0, off = 0;
+  PackedSignalStruct *packet;
+
+  source.Hold(1, SYNTH_SHORT_US); // First edge only gives the assembler a time reference
+  source.Hold(0, SYNTH_GAP_US);
+  for (unsigned long p = 0; p < count; p++)
+  {
+    for (int bit = 23; bit >= 0; bit--)
+      if ((code >> bit) & 1)
+        source.Pulse(SYNTH_LONG_US, SYNTH_SHORT_US);
+      else
+        source.Pulse(SYNTH_SHORT_US, SYNTH_LONG_US);
+    source.Pulse(SYNTH_SHORT_US, SYNTH_GAP_US);
+
+    while ((packet = Capture_Poll(source)))
+    {
+      for (int i = 1; i < packet->Number - 1; i++)
+      { // Compare with jitter free timeline, off when beyond jitter + sampling error
+        int bit = 23 - (i - 1) / 2;
+        boolean high = ((i - 1) % 2 == 0);
+        uint32_t us = (((code >> bit) & 1) == high ? SYNTH_LONG_US : SYNTH_SHORT_US);
+        int error = abs(Packed_Pulse(packet, i) - Expected(us)) * RAWSIGNAL_SAMPLE_RATE;
+        if (error > jitter_us + RAWSIGNAL_SAMPLE_RATE)
+          off++;
+        pulses++;
+      }
+      if (!packet->Widths)
+        Bytewise++;
+      Capture_Release(packet);
+      Packets++;
+    }
+  }
+  source.Hold(1, 0); // Let the last period end
+  while ((packet = Capture_Poll(source)))
+  {
+    Capture_Release(packet);
+    Packets++;
+  }
+  printf("synthetic: %lu/%lu packets (%lu a byte per pulse), %lu/%lu pulses off by more than %d us\n",
+         Packets, count, Bytewise, off, pulses, jitter_us + RAWSIGNAL_SAMPLE_RATE);
+}
+
+int main(int argc, char **argv)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  if (((argc == 3) || (argc == 4)) && (argv[1][0] == '-') && (argv[1][1] == 's'))
+    Synthetic(strtoul(argv[2], NULL, 10), (argc == 4) ? strtoul(argv[3], NULL, 10) : SYNTH_JITTER_US);
+  else if (argc == 2)
+  {
+    FILE *file = fopen(argv[1], "r");
+    if (!file)
+    {
+      perror(argv[1]);
+      return 1;
+    }
+    Replay(file);
+    fclose(file);
+  }
+  else
+  {
+    fprintf(stderr, "usage: %s <timeline.txt> | -s <packets> [<jitter_us>]\n", argv[0]);
+    return 2;
+  }
+
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  fprintf(stderr, "%lu packets, %lu dropped, %.3f s, %.0f packets/s\n",
+          Packets, Capture_Dropped, elapsed, elapsed > 0 ? Packets / elapsed : 0.0);
+  fprintf(stderr, "noise %lu, preambles %lu, short %lu, full %lu, runts %lu, repairs %lu\n",
+          SignalStats.Noise, SignalStats.Preambles, SignalStats.Short, SignalStats.Full, SignalStats.Runts, SignalStats.Repairs);
+  return 0;
+}
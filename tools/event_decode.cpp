@@ -0,0 +1,237 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host side decoder for the binary serial output of RFLink/4_Event.cpp (10;SERIAL=BINARY;)
+//
+// Build:
+//   g++ -O2 -I../RFLink -o event_decode event_decode.cpp ../RFLink/7_Utils.cpp
+//
+// Usage:
+//   event_decode [-v] [<capture>]   read the serial stream from capture (stdin by default,
+//                                   e.g. a tty set raw with stty), print each frame as the
+//                                   20;XX;... message text mode would have sent, and text
+//                                   messages as they are. -v: plugin id and size of frames.
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "4_Event.h"
+#include "7_Utils.h"
+
+// Same as Event_Formats[] in 4_Event.cpp, indexed by EventField
+enum
+{
+  AS_NAME,
+  AS_HEX,
+  AS_DEC,
+  AS_TEXT,
+  AS_CMD,
+  AS_OKLOW,
+  AS_ONOFF
+};
+
+static const struct
+{
+  const char *Label;
+  int Format;
+  int Digits; // 0: those of the field
+} Formats[] = {
+    {"", AS_NAME, 0},            // EVENT_NAME
+    {"ID", AS_HEX, 0},           // EVENT_ID
+    {"ID", AS_TEXT, 0},          // EVENT_ID_TEXT
+    {"SWITCH", AS_HEX, 2},       // EVENT_SWITCH
+    {"SWITCH", AS_TEXT, 0},      // EVENT_SWITCH_TEXT
+    {"CMD", AS_CMD, 0},          // EVENT_CMD
+    {"SET_LEVEL", AS_DEC, 2},    // EVENT_SET_LEVEL
+    {"TEMP", AS_HEX, 4},         // EVENT_TEMP
+    {"HUM", AS_DEC, 2},          // EVENT_HUM
+    {"HUM", AS_HEX, 2},          // EVENT_HUM_BCD
+    {"BARO", AS_HEX, 4},         // EVENT_BARO
+    {"HSTATUS", AS_HEX, 2},      // EVENT_HSTATUS
+    {"BFORECAST", AS_HEX, 2},    // EVENT_BFORECAST
+    {"UV", AS_HEX, 4},           // EVENT_UV
+    {"LUX", AS_HEX, 4},          // EVENT_LUX
+    {"BAT", AS_OKLOW, 0},        // EVENT_BAT
+    {"RAIN", AS_HEX, 4},         // EVENT_RAIN
+    {"RAINRATE", AS_HEX, 4},     // EVENT_RAINRATE
+    {"WINSP", AS_HEX, 4},        // EVENT_WINSP
+    {"AWINSP", AS_HEX, 4},       // EVENT_AWINSP
+    {"WINGS", AS_HEX, 4},        // EVENT_WINGS
+    {"WINDIR", AS_DEC, 3},       // EVENT_WINDIR
+    {"WINCHL", AS_HEX, 4},       // EVENT_WINCHL
+    {"WINTMP", AS_HEX, 4},       // EVENT_WINTMP
+    {"CHIME", AS_DEC, 3},        // EVENT_CHIME
+    {"SMOKEALERT", AS_ONOFF, 0}, // EVENT_SMOKEALERT
+    {"PIR", AS_ONOFF, 0},        // EVENT_PIR
+    {"CO2", AS_DEC, 4},          // EVENT_CO2
+    {"SOUND", AS_DEC, 4},        // EVENT_SOUND
+    {"KWATT", AS_HEX, 4},        // EVENT_KWATT
+    {"WATT", AS_HEX, 4},         // EVENT_WATT
+    {"CURRENT", AS_DEC, 4},      // EVENT_CURRENT
+    {"DIST", AS_DEC, 4},         // EVENT_DIST
+    {"METER", AS_DEC, 4},        // EVENT_METER
+    {"VOLT", AS_DEC, 4},         // EVENT_VOLT
+    {"RGBW", AS_HEX, 4},         // EVENT_RGBW
+};
+static_assert(sizeof(Formats) / sizeof(Formats[0]) == EVENT_FIELDS, "Formats[] must follow EventField");
+
+static const char *Commands[] = {"OFF", "ON", "BRIGHT", "DIM", "UNKNOWN"}; // CMD_OnOff
+
+static std::vector<char> Names[EVENT_FRAME_NAMES]; // As defined by the frames so far
+static unsigned long Frames = 0, FrameBytes = 0, Errors = 0, Unknown = 0;
+static boolean Verbose = false;
+
+// Frame from its length byte to its last field: false when malformed
+static boolean Decode(const byte *frame, size_t size)
+{
+  char text[512];
+  size_t length = 0, i = 3;
+
+  length += snprintf(text + length, sizeof(text) - length, "20;%02X", frame[1]);
+  while (i < size)
+  {
+    byte type = frame[i] & 0x3F, field_size = (frame[i] >> 6) + 1;
+
+    i++;
+    if (type >= EVENT_FRAME_NAME_DEF)
+    {
+      byte index = type - EVENT_FRAME_NAME_REF;
+
+      if (type == EVENT_FRAME_NAME_DEF)
+      {
+        byte count;
+
+        if (i >= size)
+          return false;
+        count = frame[i++];
+        if ((count < 1) || (i + count > size) || (frame[i] >= EVENT_FRAME_NAMES))
+          return false;
+        index = frame[i];
+        Names[index].assign(frame + i + 1, frame + i + count);
+        i += count;
+      }
+      if ((index >= EVENT_FRAME_NAMES) || Names[index].empty())
+      {
+        Unknown++; // Defined before this decoder started: select binary output again
+        length += snprintf(text + length, sizeof(text) - length, ";?");
+      }
+      else
+        length += snprintf(text + length, sizeof(text) - length, ";%.*s", (int)Names[index].size(), Names[index].data());
+    }
+    else if (type >= EVENT_FIELDS)
+      return false;
+    else if (Formats[type].Format == AS_TEXT)
+    {
+      byte count;
+
+      if (i >= size)
+        return false;
+      count = frame[i++];
+      if (i + count > size)
+        return false;
+      length += snprintf(text + length, sizeof(text) - length, ";%s=%.*s", Formats[type].Label, count, (const char *)frame + i);
+      i += count;
+    }
+    else
+    {
+      unsigned long value = 0;
+      int digits = Formats[type].Digits ? Formats[type].Digits : field_size * 2;
+
+      if (i + field_size > size)
+        return false;
+      while (field_size--)
+        value = (value << 8) | frame[i++];
+      switch (Formats[type].Format)
+      {
+      case AS_HEX:
+        length += snprintf(text + length, sizeof(text) - length, ";%s=%0*lx", Formats[type].Label, digits, value);
+        break;
+      case AS_DEC:
+        length += snprintf(text + length, sizeof(text) - length, ";%s=%0*lu", Formats[type].Label, digits, value);
+        break;
+      case AS_CMD:
+        length += snprintf(text + length, sizeof(text) - length, ";CMD=%s%s", (value & EVENT_CMD_ALL) ? "ALL" : "",
+                           Commands[((value & ~EVENT_CMD_ALL) < 4) ? (value & ~EVENT_CMD_ALL) : 4]);
+        break;
+      case AS_OKLOW:
+        length += snprintf(text + length, sizeof(text) - length, ";%s=%s", Formats[type].Label, value ? "OK" : "LOW");
+        break;
+      default:
+        length += snprintf(text + length, sizeof(text) - length, ";%s=%s", Formats[type].Label, value ? "ON" : "OFF");
+      }
+    }
+    if (length >= sizeof(text))
+      return false;
+  }
+  if (Verbose)
+    printf("[%03u %zu bytes] ", frame[2], size + 3);
+  printf("%s;\r\n", text);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  FILE *file = stdin;
+  std::vector<byte> pending;
+  size_t start = 0;
+  int c;
+
+  setvbuf(stdout, NULL, _IOLBF, 0); // Messages as they come from a tty
+  for (int a = 1; a < argc; a++)
+    if (strcmp(argv[a], "-v") == 0)
+      Verbose = true;
+    else if (!(file = fopen(argv[a], "rb")))
+    {
+      perror(argv[a]);
+      return 1;
+    }
+    else if (a != argc - 1)
+    {
+      fprintf(stderr, "usage: %s [-v] [<capture>]\n", argv[0]);
+      return 2;
+    }
+
+  while ((c = fgetc(file)) != EOF)
+  {
+    pending.push_back(c);
+    while (start < pending.size())
+    {
+      const byte *frame = pending.data() + start;
+      size_t available = pending.size() - start;
+
+      if (frame[0] != EVENT_FRAME_SYNC)
+      { // Text, passed as it is. Bytes over 0x7F can only be from a damaged frame.
+        if (frame[0] < 0x80)
+          putchar(frame[0]);
+        start++;
+        continue;
+      }
+      if ((available < 2) || (available < (size_t)frame[1] + 4))
+        break; // Rest of the frame to come
+      uint16_t crc = crc16(frame + 1, frame[1] + 1, 0x1021, 0xFFFF);
+      if ((frame[1] >= 2) && (crc == ((frame[frame[1] + 2] << 8) | frame[frame[1] + 3])) && Decode(frame + 1, frame[1] + 1))
+      {
+        Frames++;
+        FrameBytes += frame[1] + 4;
+        start += frame[1] + 4;
+      }
+      else
+      { // Not a frame, or a damaged one: look for the next sync byte
+        Errors++;
+        start++;
+      }
+    }
+    if (start == pending.size())
+    {
+      pending.clear();
+      start = 0;
+    }
+  }
+
+  fprintf(stderr, "%lu frames, %lu bytes, %lu bad, %lu unknown names\n", Frames, FrameBytes, Errors, Unknown);
+  return 0;
+}
@@ -0,0 +1,281 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host side test of the line code decoders of RFLink/5_LineCode.h
+//
+// Build:
+//   g++ -O2 -I../RFLink -o linecode_test linecode_test.cpp
+//
+// Usage:
+//   linecode_test   run each decoder on known pulse trains: valid ones, one with a pulse
+//                   out of its windows (the decoder must stop on it), packets too short,
+//                   and for Manchester the last half bit held in the ending pulse.
+//                   Prints the failed cases, returns 1 if any.
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "5_LineCode.h"
+
+#define TEST_SHORT_US 400 // 400
+#define TEST_LONG_US 1200 // 1200
+#define TEST_TOLERANCE 200 // 200
+#define TEST_HALF_US 500  // 500        // Manchester half bit
+#define TEST_GAP_US 8000  // 8000       // Ending pulse
+
+typedef PwmDecoder<TEST_SHORT_US, TEST_LONG_US, TEST_TOLERANCE> Pwm;
+typedef PpmDecoder<0, 550, 1500, 2100, 3400 + RAWSIGNAL_SAMPLE_RATE, 255 * RAWSIGNAL_SAMPLE_RATE> Ppm; // As Mebus (040)
+typedef ManchesterDecoder<TEST_HALF_US, TEST_TOLERANCE> Manchester;
+typedef TristateDecoder<TEST_SHORT_US, TEST_LONG_US, TEST_TOLERANCE> Tristate;
+
+static RawSignalStruct Signal;
+static unsigned int Cases = 0;
+static unsigned int Failed = 0;
+
+static void Check(boolean ok, const char *format, ...)
+{
+  va_list args;
+
+  Cases++;
+  if (ok)
+    return;
+  Failed++;
+  printf("FAIL: ");
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+  printf("\n");
+}
+
+// Packet of the pulses given in uSec, from Pulses[1]
+static void Packet_Clear()
+{
+  Signal.Number = 0;
+  Signal.Multiply = RAWSIGNAL_SAMPLE_RATE;
+  Signal.Pulses[0] = 0;
+}
+
+static void Packet_Add(unsigned int us)
+{
+  Signal.Pulses[++Signal.Number] = (us / RAWSIGNAL_SAMPLE_RATE > 0xFF) ? 0xFF : us / RAWSIGNAL_SAMPLE_RATE;
+}
+
+// ----------------- //
+// PWM               //
+// ----------------- //
+static void Pwm_Packet(unsigned long code, byte count)
+{
+  Packet_Clear();
+  while (count--)
+    if ((code >> count) & 1)
+    {
+      Packet_Add(TEST_LONG_US);
+      Packet_Add(TEST_SHORT_US);
+    }
+    else
+    {
+      Packet_Add(TEST_SHORT_US);
+      Packet_Add(TEST_LONG_US);
+    }
+  Packet_Add(TEST_GAP_US);
+}
+
+static void Test_Pwm()
+{
+  LineBits<24> bits;
+  boolean ok;
+
+  Pwm_Packet(0xA5C33C, 24);
+  ok = Pwm::Decode(&Signal, 1, bits);
+  Check(ok && (bits.Count == 24) && (bits.Value(0, 24) == 0xA5C33C), "PWM 0xA5C33C: %06lx", bits.Value(0, 24));
+
+  Pwm_Packet(0xA5C33C, 24);
+  Signal.Pulses[4] = ((TEST_SHORT_US + TEST_LONG_US) / 2) / RAWSIGNAL_SAMPLE_RATE; // Bit 1 is short-long
+  ok = Pwm::Decode(&Signal, 1, bits);
+  Check(ok && (bits.Value(0, 24) == 0xA5C33C), "PWM second pulse right at the split is taken as the opposite");
+
+  Pwm_Packet(0xA5C33C, 24);
+  Signal.Pulses[2 * 5 + 1] = (TEST_LONG_US + 2 * TEST_TOLERANCE) / RAWSIGNAL_SAMPLE_RATE;
+  ok = Pwm::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 5), "PWM long pulse out of tolerance at bit 5: stops there, %u bits", bits.Count);
+
+  Pwm_Packet(0xA5C33C, 24);
+  Signal.Pulses[2 * 7 + 2] = Signal.Pulses[2 * 7 + 1];
+  ok = Pwm::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 7), "PWM pair of two long pulses at bit 7: stops there, %u bits", bits.Count);
+
+  Pwm_Packet(0xA5C3, 16);
+  ok = Pwm::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 0), "PWM packet too short for 24 bits");
+}
+
+// ----------------- //
+// PPM               //
+// ----------------- //
+static void Ppm_Packet(unsigned long code, byte count)
+{
+  Packet_Clear();
+  Packet_Add(525); // Start pulse, before pos 2
+  while (count--)
+  {
+    Packet_Add(((code >> count) & 1) ? 4450 : 1875);
+    Packet_Add(375);
+  }
+}
+
+static void Test_Ppm()
+{
+  LineBits<28> bits;
+  boolean ok;
+
+  Ppm_Packet(0x4D90C87, 28);
+  ok = Ppm::Decode(&Signal, 2, bits);
+  Check((Signal.Number == 57) && ok && (bits.Value(0, 28) == 0x4D90C87), "PPM 0x4D90C87: %07lx", bits.Value(0, 28));
+
+  Ppm_Packet(0x4D90C87, 28);
+  for (int i = 2; i <= Signal.Number; i += 2)
+    if (Signal.Pulses[i] > 3400 / RAWSIGNAL_SAMPLE_RATE)
+      Signal.Pulses[i] = 8000 / RAWSIGNAL_SAMPLE_RATE;
+  ok = Ppm::Decode(&Signal, 2, bits);
+  Check(ok && (bits.Value(0, 28) == 0x4D90C87), "PPM one with no upper bound");
+
+  Ppm_Packet(0x4D90C87, 28);
+  Signal.Pulses[2 + 2 * 9] = 2800 / RAWSIGNAL_SAMPLE_RATE;
+  ok = Ppm::Decode(&Signal, 2, bits);
+  Check(!ok && (bits.Count == 9), "PPM pulse between zero and one at bit 9: stops there, %u bits", bits.Count);
+
+  Ppm_Packet(0x4D90C87, 28);
+  Signal.Pulses[3 + 2 * 12] = 700 / RAWSIGNAL_SAMPLE_RATE;
+  ok = Ppm::Decode(&Signal, 2, bits);
+  Check(!ok && (bits.Count == 12), "PPM mark too long at bit 12: stops there, %u bits", bits.Count);
+
+  Ppm_Packet(0x4D90C87, 27);
+  ok = Ppm::Decode(&Signal, 2, bits);
+  Check(!ok && (bits.Count == 0), "PPM packet too short for 28 bits");
+}
+
+// ----------------- //
+// Manchester        //
+// ----------------- //
+// Odd pulses high: the packet starts with the first half of the first bit, which must be 1
+static void Manchester_Packet(unsigned long code, byte count)
+{
+  byte level = 1;
+  byte halves = 0;
+
+  Packet_Clear();
+  while (count--)
+  {
+    byte bit = (code >> count) & 1;
+
+    for (byte half = 0; half < 2; half++)
+    {
+      byte next = half ? !bit : bit;
+
+      if (halves && (next != level))
+      {
+        Packet_Add(halves * TEST_HALF_US);
+        halves = 0;
+      }
+      level = next;
+      halves++;
+    }
+  }
+  Packet_Add(halves * TEST_HALF_US);
+}
+
+static void Test_Manchester()
+{
+  LineBits<16> bits;
+  boolean ok;
+
+  Manchester_Packet(0xB38D, 16);
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(ok && (bits.Value(0, 16) == 0xB38D), "Manchester 0xB38D: %04lx", bits.Value(0, 16));
+
+  Manchester_Packet(0xB38D, 16);
+  Signal.Pulses[Signal.Number] = TEST_GAP_US / RAWSIGNAL_SAMPLE_RATE;
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(ok && (bits.Value(0, 16) == 0xB38D), "Manchester last half bit in the ending pulse");
+
+  Manchester_Packet(0xB38D, 16);
+  Signal.Pulses[Signal.Number] = TEST_GAP_US / RAWSIGNAL_SAMPLE_RATE;
+  Packet_Add(TEST_HALF_US);
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(!ok, "Manchester long pulse that is not the ending one");
+
+  Manchester_Packet(0xB38D, 16); // 1011 0011 ...: pulses 1 (1/2), 2 (2/2) ...
+  Signal.Pulses[3] = (3 * TEST_HALF_US) / RAWSIGNAL_SAMPLE_RATE;
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count < 4), "Manchester three half bits in a pulse: stops early, %u bits", bits.Count);
+
+  Manchester_Packet(0xB3, 8);
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count < 16), "Manchester packet too short for 16 bits");
+
+  Packet_Clear(); // 1, 1 with the level of the first half of the second bit repeated
+  Packet_Add(TEST_HALF_US);
+  Packet_Add(TEST_HALF_US);
+  Packet_Add(2 * TEST_HALF_US);
+  for (byte i = 0; i < 16; i++)
+    Packet_Add(TEST_HALF_US);
+  ok = Manchester::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 1), "Manchester bit with no transition in the middle: stops there, %u bits", bits.Count);
+}
+
+// ----------------- //
+// Tristate          //
+// ----------------- //
+static void Tristate_Packet(const char *symbols)
+{
+  Packet_Clear();
+  for (; *symbols; symbols++)
+    for (byte pair = 0; pair < 2; pair++)
+    {
+      boolean one = (*symbols == '1') || ((*symbols == 'F') && pair);
+
+      Packet_Add(one ? TEST_LONG_US : TEST_SHORT_US);
+      Packet_Add(one ? TEST_SHORT_US : TEST_LONG_US);
+    }
+  Packet_Add(TEST_GAP_US);
+}
+
+static void Test_Tristate()
+{
+  LineBits<24> bits;
+  boolean ok;
+
+  Tristate_Packet("0F1F0011FF10");
+  ok = Tristate::Decode(&Signal, 1, bits);
+  Check(ok && (bits.Value(0, 24) == 0x1D0F5C), "Tristate 0F1F0011FF10: %06lx", bits.Value(0, 24));
+
+  Tristate_Packet("0F1F0011FF10");
+  Signal.Pulses[4 * 3 + 1] = TEST_LONG_US / RAWSIGNAL_SAMPLE_RATE; // F at symbol 3 becomes long-short short-long
+  Signal.Pulses[4 * 3 + 2] = TEST_SHORT_US / RAWSIGNAL_SAMPLE_RATE;
+  Signal.Pulses[4 * 3 + 3] = TEST_SHORT_US / RAWSIGNAL_SAMPLE_RATE;
+  Signal.Pulses[4 * 3 + 4] = TEST_LONG_US / RAWSIGNAL_SAMPLE_RATE;
+  ok = Tristate::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 6), "Tristate 10 at symbol 3: stops there, %u bits", bits.Count);
+
+  Tristate_Packet("0F1F0011FF10");
+  Signal.Pulses[4 * 8 + 2] = TEST_SHORT_US / RAWSIGNAL_SAMPLE_RATE;
+  ok = Tristate::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 16), "Tristate two short pulses at symbol 8: stops there, %u bits", bits.Count);
+
+  Tristate_Packet("0F1F0011FF1");
+  ok = Tristate::Decode(&Signal, 1, bits);
+  Check(!ok && (bits.Count == 0), "Tristate packet too short for 12 symbols");
+}
+
+int main()
+{
+  Test_Pwm();
+  Test_Ppm();
+  Test_Manchester();
+  Test_Tristate();
+  printf("%u cases, %u failed\n", Cases, Failed);
+  return Failed ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+// ************************************* //
+// * Arduino Project RFLink-esp        * //
+// * https://github.com/couin3/RFLink  * //
+// * 2018..2020 Stormteam - Marc RIVES * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Host side micro-benchmark of the message builder of RFLink/4_Message.cpp
+//
+// Build:
+//   g++ -O2 -I../RFLink -o message_bench message_bench.cpp ../RFLink/4_Message.cpp
+//
+// Usage:
+//   message_bench [<messages>]   build the same messages the way the display_* functions
+//                                did (sprintf_P into dbuffer, then strcat onto pbuffer) and
+//                                through MessageBuilder, check both texts match, print the
+//                                time per message of each
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "4_Message.h"
+
+#define BENCH_MESSAGES 1000000 // 1000000    // Messages of each kind, unless given
+#define PRINT_BUFFER_SIZE 90   // 90         // As in 4_Display.h
+
+static char dbuffer[30];
+static char pbuffer[PRINT_BUFFER_SIZE];
+static char mbuffer[PRINT_BUFFER_SIZE];
+static MessageBuilder Msg = {mbuffer, PRINT_BUFFER_SIZE, 0, 0};
+static volatile unsigned long Sink; // Keeps the builds from being optimised out
+
+struct Sample
+{
+  const char *Name;
+  unsigned long ID;
+  unsigned int Temp;
+  byte Hum;
+  boolean Bat;
+};
+
+static const Sample Samples[] = {
+    {"Alecto V4", 0x4d2f, 0x00d2, 55, true},
+    {"Oregon TempHygro", 0x1a2d, 0x8012, 83, false},
+    {"Cresta", 0x7c03, 0x0105, 41, true},
+    {"LaCrosse", 0x0021, 0x00ea, 67, true},
+};
+
+#define SAMPLES (sizeof(Samples) / sizeof(Samples[0]))
+
+// A weather message as the sprintf_P/strcat display_* functions wrote it, sprintf standing for sprintf_P
+static size_t Before(unsigned int number, const Sample *sample)
+{
+  pbuffer[0] = 0;
+  sprintf(dbuffer, "%s%02X", "20;", number & 0xFF);
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, ";%s", sample->Name);
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, "%s%04lx", ";ID=", sample->ID);
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, "%s%04x", ";TEMP=", sample->Temp);
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, "%s%02d", ";HUM=", sample->Hum);
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, "%s", sample->Bat ? ";BAT=OK" : ";BAT=LOW");
+  strcat(pbuffer, dbuffer);
+  sprintf(dbuffer, "%s", ";\r\n");
+  strcat(pbuffer, dbuffer);
+  return strlen(pbuffer);
+}
+
+// The same message through MessageBuilder, as display_* and Event_Render() write it now
+static size_t After(unsigned int number, const Sample *sample)
+{
+  size_t start;
+
+  Msg.Clear();
+  start = Msg.Length;
+  Msg.Commit(start, Msg.Put_P(PSTR("20;")) && Msg.PutNumber(number & 0xFF, 16, 2, true));
+  Msg.Name(sample->Name);
+  Msg.Hex(PSTR("ID"), sample->ID, 4);
+  Msg.Hex(PSTR("TEMP"), sample->Temp, 4);
+  Msg.Dec(PSTR("HUM"), sample->Hum, 2);
+  Msg.Text_P(PSTR("BAT"), sample->Bat ? PSTR("OK") : PSTR("LOW"));
+  Msg.Footer();
+  return Msg.Length;
+}
+
+static double Time(size_t (*build)(unsigned int, const Sample *), unsigned long messages)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  for (unsigned long i = 0; i < messages; i++)
+    Sink += build(i, &Samples[i % SAMPLES]);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / messages;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long messages = (argc > 1) ? strtoul(argv[1], NULL, 10) : BENCH_MESSAGES;
+  unsigned long mismatches = 0;
+
+  if (!messages)
+  {
+    fprintf(stderr, "usage: message_bench [<messages>]\n");
+    return 2;
+  }
+
+  for (unsigned int i = 0; i < 256 * SAMPLES; i++)
+  {
+    Before(i, &Samples[i % SAMPLES]);
+    After(i, &Samples[i % SAMPLES]);
+    if (strcmp(pbuffer, mbuffer))
+    {
+      if (!mismatches++)
+        printf("mismatch:\n  %s  %s", pbuffer, mbuffer);
+    }
+  }
+
+  printf("sprintf_P + strcat: %.1f ns/message\n", Time(Before, messages));
+  printf("MessageBuilder:     %.1f ns/message\n", Time(After, messages));
+  printf("%lu mismatches, %lu overflows\n", mismatches, Msg.Overflows);
+  return mismatches ? 1 : 0;
+}